@@ -1,18 +1,38 @@
 #include "StageAPIEditorImpl.h"
+#include "StageAPIStats.h"
+#include "StageAPIJournal.h"
+#include "VPStageAPIEditorModule.h"
+#include "SubSystems/StageAPIEditorSubsystem.h"
 
 #include "EngineUtils.h"
+#include "Editor.h"
 #include "DisplayClusterRootActor.h"
 #include "DisplayClusterConfigurationTypes.h"
 #include "Components/DisplayClusterICVFXCameraComponent.h"
 #include "DisplayCluster/Public/Components/DisplayClusterCameraComponent.h"
 
+#include "Algo/Sort.h"
+#include "Algo/StableSort.h"
+#include "Misc/TransactionObjectEvent.h"
+#include "Containers/Ticker.h"
+#include "Kismet/KismetMathLibrary.h"
+#include "HAL/FileManager.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
 #include "Templates/SharedPointer.h"
+#include "UObject/StrongObjectPtr.h"
 #include "Toolkits/ToolkitManager.h"
 #include "LevelSequence.h"
 #include "ILevelSequenceEditorToolkit.h"
 #include "LevelSequenceEditorBlueprintLibrary.h"
 #include "ISequencer.h"
+#include "ISequencerModule.h"
 #include "SequencerSettings.h"
+#include "MovieScene.h"
+#include "MovieSceneTimeHelpers.h"
 
 //MULTI USER & TAKE RECORDER INCUDES
 #include "TakePreset.h"
@@ -39,57 +59,261 @@
 //Private Functions
 static UWorld* s_FindWorldContext();
 static bool s_InitAPISurface();
-static void s_InitSequencer();
+static bool s_EnsureAPISurface();
+static void s_RebuildRootRegistry(UWorld* World);
+static void s_EnsureRootRegistry();
+static ADisplayClusterRootActor* s_FindRoot(FName RootName);
+static void s_BindSequencerTracking();
+static void s_UnbindSequencerTracking();
+static void s_BindEditorDelegates();
+static void s_UnbindEditorDelegates();
+static void s_NotifyStageRootChanged();
+static void s_BeginTransaction(const TCHAR* Description, UObject* PrimaryObject);
+static void s_EndTransaction();
+
+/**
+ * @brief Persistent index of the ICVFX cameras on a root, one per root so targeting another root does not throw the
+ * active root's index away. Rebuilt only when a camera is added, removed, enabled/disabled or has its render order
+ * changed, so camera A/B lookups are a pointer read.
+ */
+struct FIcvfxCameraIndex
+{
+	struct FEntry
+	{
+		TWeakObjectPtr<UDisplayClusterICVFXCameraComponent> Component;
+		bool bEnable = false;
+		int32 RenderOrder = 0;
+	};
+
+	//Every ICVFX component on the root with the state the sort was based on
+	TArray<FEntry> Entries;
+	TWeakObjectPtr<UDisplayClusterICVFXCameraComponent> CameraA;
+	TWeakObjectPtr<UDisplayClusterICVFXCameraComponent> CameraB;
+	bool bDirty = true;
+};
+
+static const FIcvfxCameraIndex& s_GetIcvfxCameraIndex(ADisplayClusterRootActor* Root);
+static void s_InvalidateIcvfxCameraIndex();
+
+/**
+ * @brief Resolved DefaultViewPoint property (per root class) and component (per root instance). The property is
+ * protected on the root actor so it has to be found through reflection.
+ */
+struct FDefaultViewPointCache
+{
+	//Null when a root class has no such property
+	TMap<TWeakObjectPtr<UClass>, FObjectProperty*> Properties;
+	TMap<TWeakObjectPtr<ADisplayClusterRootActor>, TWeakObjectPtr<UDisplayClusterCameraComponent>> Components;
+};
+
+static UDisplayClusterCameraComponent* s_GetDefaultViewPoint(ADisplayClusterRootActor* Root);
+static void s_InvalidateDefaultViewPoint();
+
+/**
+ * @brief Snapshot of the cluster nodes and viewports of a root's config, kept per root. Names are interned and the
+ * node/viewport relation is kept as flat index arrays. Generation only changes when the topology actually changes
+ * and is unique across roots, so callers can hold on to indices and compare a single integer to know if they are
+ * still valid.
+ */
+struct FStageTopology
+{
+	TArray<FName> Nodes;
+	TArray<FName> Viewports;
+	//Viewports of node N are Viewports[NodeViewportStart[N], NodeViewportStart[N + 1]), Num() == Nodes.Num() + 1
+	TArray<int32> NodeViewportStart;
+	//Node index of each viewport
+	TArray<int32> ViewportNode;
+	//Config object of each viewport, refreshed on every rebuild
+	TArray<TWeakObjectPtr<UDisplayClusterConfigurationViewport>> ViewportObjects;
+	TMap<FName, int32> NodeIndex;
+	TMap<FName, int32> ViewportIndex;
+	//FString copy for the Blueprint facing getters
+	TArray<FString> ViewportNameStrings;
+	TArray<FString> NodeNameStrings;
+	uint32 Generation = 0;
+	bool bDirty = true;
+};
+
+static const FStageTopology& s_GetStageTopology(ADisplayClusterRootActor* Root);
+static void s_InvalidateStageTopology();
 
 //Private Members
 static UWorld* s_GameWorldContext;
 static TWeakObjectPtr<ADisplayClusterRootActor> s_DisplayClusterRoot;
-static TArray<FString> s_ClusterNodes;
-static TArray<FString> s_ViewPorts;
-static TMap<FString, FString> s_ViewportToNode;
+//Every root in the world sorted by actor name, with lookups by actor name, label and tag
+static TArray<TWeakObjectPtr<ADisplayClusterRootActor>> s_DisplayClusterRoots;
+static TMap<FName, TWeakObjectPtr<ADisplayClusterRootActor>> s_RootsByName;
+static TMap<FName, TArray<TWeakObjectPtr<ADisplayClusterRootActor>>> s_RootsByTag;
+static bool s_bRootRegistryDirty = true;
+//Root selected with SetActiveRoot, kept across rescans. None picks the first root by name.
+static FName s_ActiveRootName;
+//Roots replaced by PushTargetRoot, restored by PopTargetRoot
+static TArray<TWeakObjectPtr<ADisplayClusterRootActor>> s_RootTargetStack;
+//Per root caches, entries of destroyed roots are dropped on the next registry rebuild. Entries are heap allocated
+//so references handed out stay valid when another root's entry is added
+static TMap<TWeakObjectPtr<ADisplayClusterRootActor>, TUniquePtr<FStageTopology>> s_StageTopologies;
+static uint32 s_LastTopologyGeneration = 0;
+static TMap<TWeakObjectPtr<ADisplayClusterRootActor>, TUniquePtr<FIcvfxCameraIndex>> s_IcvfxCameraIndices;
+static FDefaultViewPointCache s_DefaultViewPointCache;
+static bool s_bAPISurfaceDirty = true;
+static int32 s_APISurfaceRescanCount = 0;
+static int32 s_BatchDepth = 0;
+static int32 s_TransactionSuppressDepth = 0;
+//Instance holding the preview session. The session suppresses transactions for every caller, so there is only one
+static const UStageAPIImpl* s_PreviewSessionOwner = nullptr;
+static bool s_bBatchTransactionOpen = false;
+static FTSTicker::FDelegateHandle s_BatchWatchdogHandle;
+static bool s_bEditorDelegatesBound = false;
+static FDelegateHandle s_OnObjectPropertyChangedHandle;
+static FDelegateHandle s_OnObjectTransactedHandle;
+static FDelegateHandle s_OnObjectsReplacedHandle;
+static FDelegateHandle s_OnLevelActorAddedHandle;
+static FDelegateHandle s_OnLevelActorDeletedHandle;
+static FDelegateHandle s_OnMapChangeHandle;
+static FDelegateHandle s_OnMapOpenedHandle;
+static FDelegateHandle s_OnPostPIEStartedHandle;
+static FDelegateHandle s_OnEndPIEHandle;
+static FDelegateHandle s_OnWorldCleanupHandle;
+static FDelegateHandle s_OnBlueprintCompiledHandle;
 TWeakPtr<ISequencer> EditorSequencer;
 
-#define API_CHECK_NULL if( !IsAPIReady() && !s_InitAPISurface() ) { return nullptr; }
-#define API_CHECK_VOID if( !IsAPIReady() && !s_InitAPISurface() ) { return; }
-#define API_CHECK_BOOL if( !IsAPIReady() && !s_InitAPISurface() ) { return false; }
-#define API_CHECK_FLOAT if( !IsAPIReady() && !s_InitAPISurface() ) { return 0; }
-#define API_CHECK_ROTATOR if( !IsAPIReady() && !s_InitAPISurface() ) { return FRotator(); }
-#define API_CHECK_VECTOR if( !IsAPIReady() && !s_InitAPISurface() ) { return FVector(); }
-#define API_CHECK_VECTOR4 if( !IsAPIReady() && !s_InitAPISurface() ) { return FVector4(); }
-#define API_CHECK_NULL if( !IsAPIReady() && !s_InitAPISurface() ) { return nullptr; }
-
-#define API_CHECK_SEQ_VOID	if (!EditorSequencer.IsValid()) \
-								{s_InitSequencer();} \
+//A Level Sequence editor opened while the API was tracking Sequencer
+struct FTrackedSequencer
+{
+	TWeakPtr<ISequencer> Sequencer;
+	TWeakObjectPtr<ULevelSequence> Sequence;
+	FDelegateHandle OnCloseHandle;
+};
+
+//Open Level Sequence editors, oldest first. EditorSequencer is the one the API targets.
+static TArray<FTrackedSequencer> s_TrackedSequencers;
+static FDelegateHandle s_OnSequencerCreatedHandle;
+static bool s_bSequencerTrackingBound = false;
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Transactions Opened"), STAT_StageAPI_TransactionsOpened, STATGROUP_StageAPI);
+DECLARE_DWORD_COUNTER_STAT(TEXT("API Surface Rescans"), STAT_StageAPI_Rescans, STATGROUP_StageAPI);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Sequencer Lookups"), STAT_StageAPI_SequencerLookups, STATGROUP_StageAPI);
+
+#define API_CHECK_NULL if( !s_EnsureAPISurface() ) { return nullptr; }
+#define API_CHECK_VOID if( !s_EnsureAPISurface() ) { return; }
+#define API_CHECK_BOOL if( !s_EnsureAPISurface() ) { return false; }
+#define API_CHECK_FLOAT if( !s_EnsureAPISurface() ) { return 0; }
+#define API_CHECK_ROTATOR if( !s_EnsureAPISurface() ) { return FRotator(); }
+#define API_CHECK_VECTOR if( !s_EnsureAPISurface() ) { return FVector(); }
+#define API_CHECK_VECTOR4 if( !s_EnsureAPISurface() ) { return FVector4(); }
+#define API_CHECK_COLORGRADING if( !s_EnsureAPISurface() ) { return FStageAPIColorGrading(); }
+#define API_CHECK_ARRAY if( !s_EnsureAPISurface() ) { return {}; }
+#define API_CHECK_STRING if( !s_EnsureAPISurface() ) { return FString(); }
+#define API_CHECK_NULL if( !s_EnsureAPISurface() ) { return nullptr; }
+
+//EditorSequencer is kept current by the Sequencer module's created/close events, the checks never search for it
+#define API_CHECK_SEQ_VOID	INC_DWORD_STAT(STAT_StageAPI_SequencerLookups); if (!s_bSequencerTrackingBound) { s_BindSequencerTracking(); } \
 								if (!EditorSequencer.IsValid()) \
 								return;
 
-#define API_CHECK_SEQ_BOOL	if (!EditorSequencer.IsValid()) \
-								{ s_InitSequencer(); \
+#define API_CHECK_SEQ_BOOL	INC_DWORD_STAT(STAT_StageAPI_SequencerLookups); if (!s_bSequencerTrackingBound) { s_BindSequencerTracking(); } \
+								if (!EditorSequencer.IsValid()) \
+								return false;
+
+#define API_CHECK_SEQ_FLOAT	INC_DWORD_STAT(STAT_StageAPI_SequencerLookups); if (!s_bSequencerTrackingBound) { s_BindSequencerTracking(); } \
 								if (!EditorSequencer.IsValid()) \
-								return false;	} \
+								return 0.0f;
 
+#define API_CHECK_SEQ_INT	INC_DWORD_STAT(STAT_StageAPI_SequencerLookups); if (!s_bSequencerTrackingBound) { s_BindSequencerTracking(); } \
+								if (!EditorSequencer.IsValid()) \
+								return 0;
 
-#define API_CHECK_SEQ_FLOAT	if (!EditorSequencer.IsValid()) \
-								{ s_InitSequencer(); \
+#define API_CHECK_SEQ_NULL	INC_DWORD_STAT(STAT_StageAPI_SequencerLookups); if (!s_bSequencerTrackingBound) { s_BindSequencerTracking(); } \
 								if (!EditorSequencer.IsValid()) \
-								return 0.0f;	} \
+								return nullptr;
 
+#define API_CHECK_SEQ_FRAMETIME	INC_DWORD_STAT(STAT_StageAPI_SequencerLookups); if (!s_bSequencerTrackingBound) { s_BindSequencerTracking(); } \
+								if (!EditorSequencer.IsValid()) \
+								return FFrameTime();
 
-#define API_CHECK_SEQ_INT	if (!EditorSequencer.IsValid()) \
-								{ s_InitSequencer(); \
+#define API_CHECK_SEQ_TIMECODE	INC_DWORD_STAT(STAT_StageAPI_SequencerLookups); if (!s_bSequencerTrackingBound) { s_BindSequencerTracking(); } \
 								if (!EditorSequencer.IsValid()) \
-								return 0;	} \
+								return FTimecode();
+
+//Defers the setter to the pending write slot when write coalescing or an interaction is active
+#define API_COALESCE(Property, Value) if (TryCoalesceWrite(Property, Value)) { return; }
 
 #define TEXT_API_TAG "VP Stage API"
 
+#define LOCTEXT_NAMESPACE "StageAPIEditorImpl"
+
+static FVector4 s_RotatorToVector4(const FRotator& Rotator)
+{
+	return FVector4(Rotator.Pitch, Rotator.Yaw, Rotator.Roll, 0);
+}
+
+static FRotator s_Vector4ToRotator(const FVector4& Value)
+{
+	return FRotator(Value.X, Value.Y, Value.Z);
+}
+
+/**
+ * @brief Returns the root's DefaultViewPoint component. The property lookup is cached per root class and the
+ * component per root instance, so the steady state is a class check and a map lookup.
+ */
+UDisplayClusterCameraComponent* s_GetDefaultViewPoint(ADisplayClusterRootActor* Root)
+{
+	if (!Root)
+		return nullptr;
+
+	FDefaultViewPointCache& Cache = s_DefaultViewPointCache;
+	UClass* const RootClass = Root->GetClass();
+	FObjectProperty* const* CachedProperty = Cache.Properties.Find(RootClass);
+	FObjectProperty* const Property = CachedProperty
+		? *CachedProperty
+		: Cache.Properties.Add(RootClass, CastField<FObjectProperty>(RootClass->FindPropertyByName("DefaultViewPoint")));
+
+	TWeakObjectPtr<UDisplayClusterCameraComponent>& Component = Cache.Components.FindOrAdd(Root);
+	if (!Component.IsValid())
+	{
+		Component = Property ? Cast<UDisplayClusterCameraComponent>(Property->GetObjectPropertyValue_InContainer(Root)) : nullptr;
+	}
+
+	return Component.Get();
+}
+
+void s_InvalidateDefaultViewPoint()
+{
+	s_DefaultViewPointCache = FDefaultViewPointCache();
+}
+
 //DESTRUCTOR
 UStageAPIImpl::~UStageAPIImpl()
 {
+	if (bPreviewSessionActive)
+	{
+		--s_TransactionSuppressDepth;
+		s_PreviewSessionOwner = nullptr;
+	}
+
+	if (PendingWritesTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(PendingWritesTickerHandle);
+	}
+
+	if (TransitionsTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TransitionsTickerHandle);
+	}
+
+	s_UnbindEditorDelegates();
+	s_UnbindSequencerTracking();
 	s_DisplayClusterRoot.Reset();
-	s_ClusterNodes.Reset();
-	s_ViewPorts.Reset();
-	s_ViewportToNode.Reset();
+	s_DisplayClusterRoots.Reset();
+	s_RootsByName.Reset();
+	s_RootsByTag.Reset();
+	s_RootTargetStack.Reset();
+	s_bRootRegistryDirty = true;
+	s_StageTopologies.Reset();
+	s_IcvfxCameraIndices.Reset();
+	s_DefaultViewPointCache = FDefaultViewPointCache();
 	s_GameWorldContext = nullptr;
+	s_bAPISurfaceDirty = true;
 }
 
 
@@ -142,44 +366,84 @@ UWorld* s_FindWorldContext()
  */
 bool s_InitAPISurface()
 {
-	s_ClusterNodes.Empty();
-	s_ViewportToNode.Empty();
+	STAGEAPI_TRACE(s_InitAPISurface)
+	INC_DWORD_STAT(STAT_StageAPI_Rescans);
+
+	s_BindEditorDelegates();
+	++s_APISurfaceRescanCount;
+	s_bAPISurfaceDirty = false;
+
+	s_DisplayClusterRoot.Reset();
 	s_GameWorldContext = s_FindWorldContext();
 	if (!s_GameWorldContext)
 	{
 		//TODO: Write error log
+		s_NotifyStageRootChanged();
 		return false;
 	}
 	
 	if (UWorld* World = GEngine->GetWorldFromContextObject(s_GameWorldContext, EGetWorldErrorMode::LogAndReturnNull))
 	{
-		for (TActorIterator<AActor> It(World, ADisplayClusterRootActor::StaticClass()); It; ++It)
+		s_RebuildRootRegistry(World);
+
+		//The selected root if it still exists, otherwise the first by name so the choice does not depend on iteration order
+		ADisplayClusterRootActor* ActiveRoot = nullptr;
+		if (const TWeakObjectPtr<ADisplayClusterRootActor>* SelectedRoot = s_RootsByName.Find(s_ActiveRootName))
 		{
-			s_DisplayClusterRoot = MakeWeakObjectPtr(Cast<ADisplayClusterRootActor>(*It));
+			ActiveRoot = SelectedRoot->Get();
 		}
+		if (!ActiveRoot && s_DisplayClusterRoots.Num() > 0)
+		{
+			ActiveRoot = s_DisplayClusterRoots[0].Get();
+		}
+		s_DisplayClusterRoot = ActiveRoot;
 	}
 
 	if (s_DisplayClusterRoot.IsValid())
 	{
 		//Build the tables containing the cluster node and viewport lists.
-		for (TPair<FString ,UDisplayClusterConfigurationClusterNode*>& Node : s_DisplayClusterRoot->GetConfigData()->Cluster->Nodes)
-		{
-			s_ClusterNodes.Add(Node.Key);
-			for (TPair<FString, UDisplayClusterConfigurationViewport*>& Viewport : Node.Value->Viewports)
-			{
-				s_ViewPorts.Add(Viewport.Key);
-				s_ViewportToNode.Add(Viewport.Key, Node.Key);
-			}
-		}
+		s_GetStageTopology(s_DisplayClusterRoot.Get());
+		s_NotifyStageRootChanged();
 		return true;
 	}
 	else
 	{
+		s_NotifyStageRootChanged();
 		return false;
 	}
 }
 
+/**
+ * @brief Makes sure the API surface is usable without rescanning the world on every call. The surface is only rebuilt
+ * when an editor or world event has flagged that the stage topology may have changed, also while the current root is
+ * still valid (e.g. PIE starting leaves the editor world root alive).
+ * @return true if a nDisplay Cluster Root Actor is available
+ */
+bool s_EnsureAPISurface()
+{
+	//A pushed target root is kept until it is popped, the rescan happens on the next call after that
+	if (s_DisplayClusterRoot.IsValid() && (!s_bAPISurfaceDirty || s_RootTargetStack.Num() > 0))
+		return true;
+
+	//API_CHECK_* slow path
+	STAGEAPI_TRACE(s_EnsureAPISurface)
+
+	//The root went away without an event we listen to (e.g. garbage collected), allow a single rescan
+	if (s_DisplayClusterRoot.IsStale())
+	{
+		s_DisplayClusterRoot.Reset();
+		s_bAPISurfaceDirty = true;
+	}
+
+	if (!s_bAPISurfaceDirty)
+		return false;
+
+	return s_InitAPISurface();
+}
+
 bool UStageAPIImpl::IsAPIReady() const {
+	STAGEAPI_TRACE(IsAPIReady)
+	STAGEAPI_JOURNAL(IsAPIReady)
 	if (s_DisplayClusterRoot.IsValid())
 	{
 		return true;
@@ -189,171 +453,1928 @@ bool UStageAPIImpl::IsAPIReady() const {
 
 bool UStageAPIImpl::InitAPISurface()
 {
+	STAGEAPI_TRACE(InitAPISurface)
+	STAGEAPI_JOURNAL(InitAPISurface)
 	return s_InitAPISurface();
 }
 
+int32 UStageAPIImpl::GetAPISurfaceRescanCount() const
+{
+	STAGEAPI_TRACE(GetAPISurfaceRescanCount)
+	STAGEAPI_JOURNAL(GetAPISurfaceRescanCount)
+	return s_APISurfaceRescanCount;
+}
+
 
 //////////////////////////////////////////////////////////////////////////////////////////////
-// PRIVATE CAMERA FUNCTIONS
+// ICVFX CAMERA INDEX & EDITOR EVENTS
 //////////////////////////////////////////////////////////////////////////////////////////////
-#pragma region "Private Camera Functions"
+#pragma region "ICVFX Camera Index & Editor Events"
 
-ACineCameraActor* UStageAPIImpl::GetFrustumCamera_ByComponent(UDisplayClusterICVFXCameraComponent* IcvfxComponent) const
+/**
+ * @brief Rebuilds the camera index for the given root. Camera A is the enabled camera with the highest render order,
+ * camera B the one with the lowest. On equal orders the first component found wins, matching the original scan.
+ */
+static void s_RebuildIcvfxCameraIndex(ADisplayClusterRootActor* Root, FIcvfxCameraIndex& CameraIndex)
 {
-	if (!IcvfxComponent)
-		return nullptr;
+	STAGEAPI_TRACE(s_RebuildIcvfxCameraIndex)
+	CameraIndex.Entries.Reset();
+	CameraIndex.CameraA.Reset();
+	CameraIndex.CameraB.Reset();
+	CameraIndex.bDirty = false;
 
-	return IcvfxComponent->CameraSettings.ExternalCameraActor.Get();
-	
-}
-float UStageAPIImpl::GetFrustumFOVMult_ByComponent(UDisplayClusterICVFXCameraComponent* IcvfxComponent) const
-{
-	if (!IcvfxComponent)
-		return 0;
-	
-	return IcvfxComponent->CameraSettings.BufferRatio;
-}
-void UStageAPIImpl::SetFrustumFOVMult_ByComponent(UDisplayClusterICVFXCameraComponent* IcvfxComponent, float FOVMult)
-{
-	if (!IcvfxComponent)
+	if (!Root)
 		return;
 
-	GEngine->BeginTransaction(*FString(TEXT(TEXT_API_TAG)), FText::FromString(TEXT("Set Frustum FOV Mult")), s_DisplayClusterRoot.Get());
+	TInlineComponentArray<UDisplayClusterICVFXCameraComponent*> AvailableICVFXComponents(Root);
+	TArray<UDisplayClusterICVFXCameraComponent*, TInlineAllocator<8>> EnabledICVFXComponents;
 
-	IcvfxComponent->Modify();
-	IcvfxComponent->CameraSettings.BufferRatio = FOVMult;
+	for (UDisplayClusterICVFXCameraComponent* ICVFXComponent : AvailableICVFXComponents)
+	{
+		FIcvfxCameraIndex::FEntry& Entry = CameraIndex.Entries.AddDefaulted_GetRef();
+		Entry.Component = ICVFXComponent;
+		Entry.bEnable = ICVFXComponent->CameraSettings.bEnable;
+		Entry.RenderOrder = ICVFXComponent->CameraSettings.RenderSettings.RenderOrder;
 
-	GEngine->EndTransaction();
-	
-}
-float UStageAPIImpl::GetFrustumExposure_ByComponent(UDisplayClusterICVFXCameraComponent* IcvfxComponent) const
-{
-	if (!IcvfxComponent)
-		return 0;
+		if (Entry.bEnable)
+			EnabledICVFXComponents.Add(ICVFXComponent);
+	}
 
-	return IcvfxComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.AutoExposureBias;
+	if (EnabledICVFXComponents.Num() == 0)
+		return;
+
+	Algo::StableSort(EnabledICVFXComponents, [](const UDisplayClusterICVFXCameraComponent* A, const UDisplayClusterICVFXCameraComponent* B)
+	{
+		return A->CameraSettings.RenderSettings.RenderOrder > B->CameraSettings.RenderSettings.RenderOrder;
+	});
+
+	//The lowest order group sits at the end of the sorted list, B is the first component of that group
+	int32 CameraBIndex = EnabledICVFXComponents.Num() - 1;
+	int32 const LowestRenderOrder = EnabledICVFXComponents[CameraBIndex]->CameraSettings.RenderSettings.RenderOrder;
+	while (CameraBIndex > 0 && EnabledICVFXComponents[CameraBIndex - 1]->CameraSettings.RenderSettings.RenderOrder == LowestRenderOrder)
+	{
+		--CameraBIndex;
+	}
+
+	CameraIndex.CameraA = EnabledICVFXComponents[0];
+	CameraIndex.CameraB = EnabledICVFXComponents[CameraBIndex];
 }
-float UStageAPIImpl::GetFrustumAperture_ByComponent(UDisplayClusterICVFXCameraComponent* IcvfxComponent) const
+
+/**
+ * @brief Returns the camera index for the given root, rebuilding it only when it has been invalidated or one of the
+ * cached cameras has been destroyed (e.g. by a construction script re-run). The reference stays valid until the
+ * root is destroyed and its index dropped by the next registry rebuild.
+ */
+const FIcvfxCameraIndex& s_GetIcvfxCameraIndex(ADisplayClusterRootActor* Root)
 {
-	auto FrustumCamera = GetFrustumCamera_ByComponent(IcvfxComponent);
+	static const FIcvfxCameraIndex EmptyIndex;
+	if (!Root)
+		return EmptyIndex;
 
-	if (!FrustumCamera) return 0;
+	s_BindEditorDelegates();
 
-	return FrustumCamera->GetCineCameraComponent()->CurrentAperture; 
+	TUniquePtr<FIcvfxCameraIndex>& CameraIndexEntry = s_IcvfxCameraIndices.FindOrAdd(Root);
+	if (!CameraIndexEntry)
+	{
+		CameraIndexEntry = MakeUnique<FIcvfxCameraIndex>();
+	}
+
+	FIcvfxCameraIndex& CameraIndex = *CameraIndexEntry;
+	if (CameraIndex.bDirty
+		|| CameraIndex.CameraA.IsStale()
+		|| CameraIndex.CameraB.IsStale())
+	{
+		s_RebuildIcvfxCameraIndex(Root, CameraIndex);
+	}
+
+	return CameraIndex;
 }
-void UStageAPIImpl::SetFrustumExposure_ByComponent(UDisplayClusterICVFXCameraComponent* IcvfxComponent, float FrustumExposure)
+
+void s_InvalidateIcvfxCameraIndex()
 {
-	if (!IcvfxComponent)
+	for (TPair<TWeakObjectPtr<ADisplayClusterRootActor>, TUniquePtr<FIcvfxCameraIndex>>& CameraIndex : s_IcvfxCameraIndices)
+	{
+		CameraIndex.Value->bDirty = true;
+	}
+}
+
+/**
+ * @brief Invalidates the camera index if the changed object affects camera selection. ICVFX components only
+ * invalidate when their enabled state or render order differs from what the index was built from, so the
+ * API's own transactions (exposure, grades etc.) leave the index intact.
+ */
+static void s_OnIcvfxObjectChanged(UObject* Object, bool bComponentsChanged)
+{
+	if (!Object || s_IcvfxCameraIndices.Num() == 0)
 		return;
 
-	GEngine->BeginTransaction(*FString(TEXT(TEXT_API_TAG)), FText::FromString(TEXT("Set Frustum FOV Mult")), s_DisplayClusterRoot.Get());
+	if (UDisplayClusterICVFXCameraComponent* ICVFXComponent = Cast<UDisplayClusterICVFXCameraComponent>(Object))
+	{
+		TUniquePtr<FIcvfxCameraIndex>* CameraIndexEntry = s_IcvfxCameraIndices.Find(Cast<ADisplayClusterRootActor>(ICVFXComponent->GetOwner()));
+		FIcvfxCameraIndex* CameraIndex = CameraIndexEntry ? CameraIndexEntry->Get() : nullptr;
+		if (!CameraIndex || CameraIndex->bDirty)
+			return;
 
-	IcvfxComponent->Modify();
-	IcvfxComponent->CameraSettings.AllNodesColorGrading.bEnableEntireClusterColorGrading = true;
-	IcvfxComponent->CameraSettings.AllNodesColorGrading.bEnableInnerFrustumAllNodesColorGrading = true;
-	IcvfxComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.bOverride_AutoExposureBias = true;
-	IcvfxComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.AutoExposureBias = FrustumExposure;
+		for (const FIcvfxCameraIndex::FEntry& Entry : CameraIndex->Entries)
+		{
+			if (Entry.Component.Get() == ICVFXComponent)
+			{
+				if (Entry.bEnable != ICVFXComponent->CameraSettings.bEnable
+					|| Entry.RenderOrder != ICVFXComponent->CameraSettings.RenderSettings.RenderOrder)
+				{
+					CameraIndex->bDirty = true;
+				}
+				return;
+			}
+		}
 
-	GEngine->EndTransaction();
+		//A camera on this root that the index has never seen
+		CameraIndex->bDirty = true;
+	}
+	else if (bComponentsChanged)
+	{
+		if (TUniquePtr<FIcvfxCameraIndex>* CameraIndex = s_IcvfxCameraIndices.Find(Cast<ADisplayClusterRootActor>(Object)))
+		{
+			(*CameraIndex)->bDirty = true;
+		}
+	}
 }
-void UStageAPIImpl::SetFrustumAperture_ByComponent(UDisplayClusterICVFXCameraComponent* IcvfxComponent, float FrustumAperture)
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+// STAGE TOPOLOGY
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief Rebuilds the topology snapshot from the root's config. A new generation is only taken if the nodes or
+ * viewports differ from the previous snapshot, re-reading an unchanged config is invisible to callers.
+ */
+static void s_RebuildStageTopology(ADisplayClusterRootActor* Root, FStageTopology& Topology)
 {
-	auto FrustumCamera = GetFrustumCamera_ByComponent(IcvfxComponent);
+	STAGEAPI_TRACE(s_RebuildStageTopology)
 
-	if (!FrustumCamera) return;
+	TArray<FName> Nodes;
+	TArray<FName> Viewports;
+	TArray<int32> NodeViewportStart;
+	TArray<int32> ViewportNode;
+	TArray<TWeakObjectPtr<UDisplayClusterConfigurationViewport>> ViewportObjects;
 
-	GEngine->BeginTransaction(*FString(TEXT(TEXT_API_TAG)), FText::FromString(TEXT("Update frustum aperture")), FrustumCamera);
+	UDisplayClusterConfigurationData* ConfigData = Root ? Root->GetConfigData() : nullptr;
+	if (ConfigData && ConfigData->Cluster)
+	{
+		Nodes.Reserve(ConfigData->Cluster->Nodes.Num());
+		NodeViewportStart.Reserve(ConfigData->Cluster->Nodes.Num() + 1);
 
-	FrustumCamera->GetCineCameraComponent()->Modify();
-	FrustumCamera->GetCineCameraComponent()->CurrentAperture = FrustumAperture;
-	
-	GEngine->EndTransaction();
-	
-}
-void UStageAPIImpl::SetFrustumFocalDistance_ByComponent(UDisplayClusterICVFXCameraComponent* IcvfxComponent,float FocalDistance)
-{
-	auto FrustumCamera = GetFrustumCamera_ByComponent(IcvfxComponent);
+		for (const TPair<FString, UDisplayClusterConfigurationClusterNode*>& Node : ConfigData->Cluster->Nodes)
+		{
+			int32 const NodeIdx = Nodes.Add(FName(*Node.Key));
+			NodeViewportStart.Add(Viewports.Num());
 
-	if (!FrustumCamera)
+			if (!Node.Value)
+				continue;
+
+			for (const TPair<FString, UDisplayClusterConfigurationViewport*>& Viewport : Node.Value->Viewports)
+			{
+				Viewports.Add(FName(*Viewport.Key));
+				ViewportNode.Add(NodeIdx);
+				ViewportObjects.Add(Viewport.Value);
+			}
+		}
+	}
+	NodeViewportStart.Add(Viewports.Num());
+
+	Topology.ViewportObjects = MoveTemp(ViewportObjects);
+	Topology.bDirty = false;
+
+	if (Topology.Generation != 0 && Nodes == Topology.Nodes && Viewports == Topology.Viewports && NodeViewportStart == Topology.NodeViewportStart)
 		return;
 
-	GEngine->BeginTransaction(*FString(TEXT(TEXT_API_TAG)), FText::FromString(TEXT("Update frustum focal distance")), FrustumCamera);
+	Topology.Nodes = MoveTemp(Nodes);
+	Topology.Viewports = MoveTemp(Viewports);
+	Topology.NodeViewportStart = MoveTemp(NodeViewportStart);
+	Topology.ViewportNode = MoveTemp(ViewportNode);
 
-	FrustumCamera->GetCineCameraComponent()->Modify();
-	FrustumCamera->GetCineCameraComponent()->FocusSettings.ManualFocusDistance = FocalDistance;
-	
-	GEngine->EndTransaction();
+	Topology.NodeIndex.Reset();
+	Topology.NodeNameStrings.Reset(Topology.Nodes.Num());
+	for (int32 NodeIdx = 0; NodeIdx < Topology.Nodes.Num(); ++NodeIdx)
+	{
+		Topology.NodeIndex.Add(Topology.Nodes[NodeIdx], NodeIdx);
+		Topology.NodeNameStrings.Add(Topology.Nodes[NodeIdx].ToString());
+	}
+
+	Topology.ViewportIndex.Reset();
+	Topology.ViewportNameStrings.Reset(Topology.Viewports.Num());
+	for (int32 ViewportIdx = 0; ViewportIdx < Topology.Viewports.Num(); ++ViewportIdx)
+	{
+		Topology.ViewportIndex.Add(Topology.Viewports[ViewportIdx], ViewportIdx);
+		Topology.ViewportNameStrings.Add(Topology.Viewports[ViewportIdx].ToString());
+	}
+
+	Topology.Generation = ++s_LastTopologyGeneration;
 }
 
-float UStageAPIImpl::GetFrustumFocalDistance_ByComponent(UDisplayClusterICVFXCameraComponent* IcvfxComponent) const
+/**
+ * @brief Returns the topology of the given root, rebuilding it only after the config has been flagged as changed.
+ * The reference stays valid until the root is destroyed and its topology dropped by the next registry rebuild.
+ */
+const FStageTopology& s_GetStageTopology(ADisplayClusterRootActor* Root)
 {
-	auto FrustumCamera = GetFrustumCamera_ByComponent(IcvfxComponent);
+	static const FStageTopology EmptyTopology;
+	if (!Root)
+		return EmptyTopology;
 
-	if (!FrustumCamera)
-		return  0;
+	TUniquePtr<FStageTopology>& TopologyEntry = s_StageTopologies.FindOrAdd(Root);
+	if (!TopologyEntry)
+	{
+		TopologyEntry = MakeUnique<FStageTopology>();
+	}
 
-	return FrustumCamera->GetCineCameraComponent()->FocusSettings.ManualFocusDistance;
-}
-FRotator UStageAPIImpl::GetFrustumRotation_ByComponent(UDisplayClusterICVFXCameraComponent* IcvfxComponent) const
-{
-	auto frustumCamera = GetFrustumCamera_ByComponent(IcvfxComponent);
-	if (!frustumCamera)
-		return  FRotator();
+	FStageTopology& Topology = *TopologyEntry;
+	if (Topology.bDirty)
+	{
+		s_RebuildStageTopology(Root, Topology);
+	}
 
-	return frustumCamera->GetRootComponent()->GetRelativeRotation();
+	return Topology;
 }
-void UStageAPIImpl::SetFrustumRotation_ByComponent(UDisplayClusterICVFXCameraComponent* IcvfxComponent,FRotator NewRotation)
+
+void s_InvalidateStageTopology()
 {
-	auto FrustumCamera = GetFrustumCamera_ByComponent(IcvfxComponent);
+	for (TPair<TWeakObjectPtr<ADisplayClusterRootActor>, TUniquePtr<FStageTopology>>& Topology : s_StageTopologies)
+	{
+		Topology.Value->bDirty = true;
+	}
+}
 
-	if (!FrustumCamera)
+/**
+ * @brief Nodes live in the cluster's Nodes map and viewports in each node's Viewports map, so only edits on
+ * those two objects of the snapshot's config can change the topology. Viewport settings edits are ignored.
+ */
+static void s_OnTopologyObjectChanged(UObject* Object)
+{
+	if (!Object)
 		return;
 
-	GEngine->BeginTransaction(*FString(TEXT(TEXT_API_TAG)), FText::FromString(TEXT("Set Frustum Rotation")), FrustumCamera);
-	FrustumCamera->SetActorRotation(NewRotation,ETeleportType::None);
-	FrustumCamera->GetRootComponent()->Modify();
-	FrustumCamera->GetRootComponent()->SetRelativeRotation(NewRotation);
-	FrustumCamera->Modify();
-	GEngine->EndTransaction();
+	if (Object->IsA<UDisplayClusterConfigurationCluster>() || Object->IsA<UDisplayClusterConfigurationClusterNode>())
+	{
+		for (TPair<TWeakObjectPtr<ADisplayClusterRootActor>, TUniquePtr<FStageTopology>>& Topology : s_StageTopologies)
+		{
+			if (Topology.Value->bDirty)
+				continue;
+
+			ADisplayClusterRootActor* Root = Topology.Key.Get();
+			UDisplayClusterConfigurationData* ConfigData = Root ? Root->GetConfigData() : nullptr;
+			if (!ConfigData || Object->IsIn(ConfigData) || Object->IsIn(Root))
+			{
+				Topology.Value->bDirty = true;
+			}
+		}
+	}
 }
-void UStageAPIImpl::SetFrustumRotationPreview_ByComponent(UDisplayClusterICVFXCameraComponent* IcvfxComponent,FRotator NewRotation)
+
+static void s_HandleObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& PropertyChangedEvent)
 {
-	auto FrustumCamera = GetFrustumCamera_ByComponent(IcvfxComponent);
+	s_OnIcvfxObjectChanged(Object, true);
+	s_OnTopologyObjectChanged(Object);
 
-	if (!FrustumCamera)
-		return;
+	//Renaming or retagging a root changes its registry keys
+	if (Object && Object->IsA<ADisplayClusterRootActor>()
+		&& (PropertyChangedEvent.GetPropertyName() == GET_MEMBER_NAME_CHECKED(AActor, Tags) || PropertyChangedEvent.GetPropertyName() == TEXT("ActorLabel")))
+	{
+		s_bRootRegistryDirty = true;
+	}
 
-	FrustumCamera->SetActorRotation(NewRotation,ETeleportType::None);
+	//The viewpoint component can be reassigned or recreated from the details panel
+	if (Object && Object->IsA<ADisplayClusterRootActor>())
+	{
+		s_DefaultViewPointCache.Components.Remove(Cast<ADisplayClusterRootActor>(Object));
+	}
 }
-FVector UStageAPIImpl::GetFrustumPosition_ByComponent(UDisplayClusterICVFXCameraComponent* IcvfxComponent) const
-{
-	auto frustumCamera = GetFrustumCamera_ByComponent(IcvfxComponent);
-	if (!frustumCamera)
-		return  FVector();
 
-	return frustumCamera->GetRootComponent()->GetComponentLocation();
-}
-void UStageAPIImpl::SetFrustumPosition_ByComponent(UDisplayClusterICVFXCameraComponent* IcvfxComponent, FVector NewPosition)
+static void s_HandleObjectTransacted(UObject* Object, const FTransactionObjectEvent& TransactionEvent)
 {
+	//Undo/redo and Multi-User transactions. Instance components are not tracked as properties on the actor.
+	bool const bComponentsChanged = TransactionEvent.HasNonPropertyChanges()
+		|| TransactionEvent.GetChangedProperties().Contains(TEXT("InstanceComponents"))
+		|| TransactionEvent.GetChangedProperties().Contains(TEXT("BlueprintCreatedComponents"));
+
+	s_OnIcvfxObjectChanged(Object, bComponentsChanged);
+	s_OnTopologyObjectChanged(Object);
+
+	if (bComponentsChanged && Object && Object->IsA<ADisplayClusterRootActor>())
+	{
+		s_DefaultViewPointCache.Components.Remove(Cast<ADisplayClusterRootActor>(Object));
+	}
+}
+
+static void s_HandleObjectsReplaced(const TMap<UObject*, UObject*>& ReplacementMap)
+{
+	//Blueprint recompile of the nDisplay config re-instances the root and its components
+	s_InvalidateIcvfxCameraIndex();
+	s_InvalidateDefaultViewPoint();
+	s_InvalidateStageTopology();
+	if (s_DisplayClusterRoot.IsValid() && ReplacementMap.Contains(s_DisplayClusterRoot.Get()))
+	{
+		s_bAPISurfaceDirty = true;
+	}
+}
+
+//API SURFACE EVENTS
+//Anything that can add, remove or swap the root actor (or the world it lives in) flags the surface for a rescan
+
+static void s_InvalidateAPISurface()
+{
+	s_bAPISurfaceDirty = true;
+	s_bRootRegistryDirty = true;
+	s_InvalidateIcvfxCameraIndex();
+	s_InvalidateDefaultViewPoint();
+	s_InvalidateStageTopology();
+}
+
+static void s_HandleBlueprintCompiled()
+{
+	//Compiling reuses the generated class but relinks its properties, so the cached FProperty may be gone
+	s_InvalidateDefaultViewPoint();
+}
+
+static void s_HandleLevelActorAdded(AActor* Actor)
+{
+	if (Actor && Actor->IsA<ADisplayClusterRootActor>())
+	{
+		s_InvalidateAPISurface();
+	}
+}
+
+static void s_HandleLevelActorDeleted(AActor* Actor)
+{
+	if (Actor && Actor == s_DisplayClusterRoot.Get())
+	{
+		s_DisplayClusterRoot.Reset();
+		s_InvalidateAPISurface();
+	}
+	else if (Actor && Actor->IsA<ADisplayClusterRootActor>())
+	{
+		s_bRootRegistryDirty = true;
+	}
+}
+
+static void s_HandleMapChange(uint32 MapChangeFlags)
+{
+	s_InvalidateAPISurface();
+}
+
+static void s_HandleMapOpened(const FString& Filename, bool bAsTemplate)
+{
+	s_InvalidateAPISurface();
+}
+
+static void s_HandlePIEChanged(bool bIsSimulating)
+{
+	s_InvalidateAPISurface();
+}
+
+static void s_HandleWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources)
+{
+	if (World && World == s_GameWorldContext)
+	{
+		s_DisplayClusterRoot.Reset();
+		s_GameWorldContext = nullptr;
+		s_InvalidateAPISurface();
+	}
+}
+
+/**
+ * @brief Subscribes to the editor events that invalidate the API's cached state. Called lazily from the API so the
+ * delegates are only bound once the API is in use.
+ */
+void s_BindEditorDelegates()
+{
+	if (s_bEditorDelegatesBound)
+		return;
+
+	s_bEditorDelegatesBound = true;
+	s_OnObjectPropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddStatic(&s_HandleObjectPropertyChanged);
+	s_OnObjectTransactedHandle = FCoreUObjectDelegates::OnObjectTransacted.AddStatic(&s_HandleObjectTransacted);
+	s_OnObjectsReplacedHandle = FCoreUObjectDelegates::OnObjectsReplaced.AddStatic(&s_HandleObjectsReplaced);
+
+	if (GEngine)
+	{
+		s_OnLevelActorAddedHandle = GEngine->OnLevelActorAdded().AddStatic(&s_HandleLevelActorAdded);
+		s_OnLevelActorDeletedHandle = GEngine->OnLevelActorDeleted().AddStatic(&s_HandleLevelActorDeleted);
+	}
+	s_OnMapChangeHandle = FEditorDelegates::MapChange.AddStatic(&s_HandleMapChange);
+	s_OnMapOpenedHandle = FEditorDelegates::OnMapOpened.AddStatic(&s_HandleMapOpened);
+	s_OnPostPIEStartedHandle = FEditorDelegates::PostPIEStarted.AddStatic(&s_HandlePIEChanged);
+	s_OnEndPIEHandle = FEditorDelegates::EndPIE.AddStatic(&s_HandlePIEChanged);
+	s_OnWorldCleanupHandle = FWorldDelegates::OnWorldCleanup.AddStatic(&s_HandleWorldCleanup);
+
+	if (GEditor)
+	{
+		s_OnBlueprintCompiledHandle = GEditor->OnBlueprintCompiled().AddStatic(&s_HandleBlueprintCompiled);
+	}
+}
+
+void s_UnbindEditorDelegates()
+{
+	if (!s_bEditorDelegatesBound)
+		return;
+
+	FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(s_OnObjectPropertyChangedHandle);
+	FCoreUObjectDelegates::OnObjectTransacted.Remove(s_OnObjectTransactedHandle);
+	FCoreUObjectDelegates::OnObjectsReplaced.Remove(s_OnObjectsReplacedHandle);
+
+	if (GEngine)
+	{
+		GEngine->OnLevelActorAdded().Remove(s_OnLevelActorAddedHandle);
+		GEngine->OnLevelActorDeleted().Remove(s_OnLevelActorDeletedHandle);
+	}
+	FEditorDelegates::MapChange.Remove(s_OnMapChangeHandle);
+	FEditorDelegates::OnMapOpened.Remove(s_OnMapOpenedHandle);
+	FEditorDelegates::PostPIEStarted.Remove(s_OnPostPIEStartedHandle);
+	FEditorDelegates::EndPIE.Remove(s_OnEndPIEHandle);
+	FWorldDelegates::OnWorldCleanup.Remove(s_OnWorldCleanupHandle);
+
+	if (GEditor)
+	{
+		GEditor->OnBlueprintCompiled().Remove(s_OnBlueprintCompiledHandle);
+	}
+	s_bEditorDelegatesBound = false;
+}
+
+#pragma endregion
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+// TRANSACTIONS & BATCHING
+//////////////////////////////////////////////////////////////////////////////////////////////
+#pragma region "Transactions & Batching"
+
+/**
+ * @brief Tells the notification subsystem that an API call changed the stage. Local-only changes (previews,
+ * suppressed transactions) raise no transaction events, so the setters report them directly.
+ */
+static void s_NotifyStageChanged()
+{
+	if (UStageAPIEditorSubsystem* Subsystem = GEditor ? GEditor->GetEditorSubsystem<UStageAPIEditorSubsystem>() : nullptr)
+	{
+		Subsystem->MarkStagePropertiesDirty();
+	}
+}
+
+/**
+ * @brief Hands the root found by a rescan to the notification subsystem, which takes its baseline from it.
+ */
+void s_NotifyStageRootChanged()
+{
+	if (UStageAPIEditorSubsystem* Subsystem = GEditor ? GEditor->GetEditorSubsystem<UStageAPIEditorSubsystem>() : nullptr)
+	{
+		Subsystem->SetStageRoot(s_DisplayClusterRoot.Get());
+	}
+}
+
+/**
+ * @brief Opens an undo/Multi-User transaction for a single API setter. Inside a batch the setter joins the batch
+ * transaction instead, so the whole batch is serialized and sent to the cluster as one Concert payload.
+ */
+void s_BeginTransaction(const TCHAR* Description, UObject* PrimaryObject)
+{
+	//Every API setter opens a transaction, even when it ends up suppressed
+	s_NotifyStageChanged();
+
+	if (s_BatchDepth > 0 || s_TransactionSuppressDepth > 0)
+		return;
+
+	INC_DWORD_STAT(STAT_StageAPI_TransactionsOpened);
+	GEngine->BeginTransaction(TEXT(TEXT_API_TAG), FText::FromString(Description), PrimaryObject);
+}
+
+void s_EndTransaction()
+{
+	if (s_BatchDepth > 0 || s_TransactionSuppressDepth > 0)
+		return;
+
+	//Ending the transaction serializes it and hands it to Multi-User
+	STAGEAPI_TRACE(s_EndTransaction)
+	GEngine->EndTransaction();
+}
+
+/**
+ * @brief Commits any batch still open at the end of the frame. A batch left open by a widget would otherwise hold the
+ * transaction buffer open and stop anything from reaching the other Multi-User clients.
+ */
+static bool s_BatchWatchdog(float DeltaTime)
+{
+	s_BatchWatchdogHandle.Reset();
+
+	if (s_BatchDepth > 0)
+	{
+		UE_LOG(StageAPIEditor, Warning, TEXT("VP Stage API batch was not committed within the frame, committing it now"));
+		s_BatchDepth = 0;
+		if (s_bBatchTransactionOpen)
+		{
+			s_bBatchTransactionOpen = false;
+			GEngine->EndTransaction();
+		}
+	}
+	return false;
+}
+
+void UStageAPIImpl::BeginBatch(const FString& Description)
+{
+	STAGEAPI_TRACE(BeginBatch)
+	STAGEAPI_JOURNAL(BeginBatch, Description)
+	if (s_BatchDepth++ > 0)
+		return;
+
+	//Batches opened while transactions are suppressed (e.g. during a preview session) are local only
+	if (s_TransactionSuppressDepth > 0)
+		return;
+
+	INC_DWORD_STAT(STAT_StageAPI_TransactionsOpened);
+	GEngine->BeginTransaction(TEXT(TEXT_API_TAG), Description.IsEmpty() ? LOCTEXT("DefaultBatchDescription", "VP Stage API Batch") : FText::FromString(Description), nullptr);
+	s_bBatchTransactionOpen = true;
+
+	if (!s_BatchWatchdogHandle.IsValid())
+	{
+		s_BatchWatchdogHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateStatic(&s_BatchWatchdog));
+	}
+}
+
+void UStageAPIImpl::CommitBatch()
+{
+	STAGEAPI_TRACE(CommitBatch)
+	STAGEAPI_JOURNAL(CommitBatch)
+	if (s_BatchDepth == 0)
+	{
+		UE_LOG(StageAPIEditor, Warning, TEXT("VP Stage API CommitBatch called without a matching BeginBatch"));
+		return;
+	}
+
+	if (--s_BatchDepth > 0 || !s_bBatchTransactionOpen)
+		return;
+
+	s_bBatchTransactionOpen = false;
+	GEngine->EndTransaction();
+
+	if (s_BatchWatchdogHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(s_BatchWatchdogHandle);
+		s_BatchWatchdogHandle.Reset();
+	}
+}
+
+bool UStageAPIImpl::IsBatchOpen() const
+{
+	STAGEAPI_TRACE(IsBatchOpen)
+	STAGEAPI_JOURNAL(IsBatchOpen)
+	return s_BatchDepth > 0;
+}
+
+#pragma endregion
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+// PROPERTY ACCESS
+//////////////////////////////////////////////////////////////////////////////////////////////
+#pragma region "Property Access"
+
+/**
+ * @brief Frustum camera position in the space SetFrustumPosition_ByComponent writes (relative to the camera's parent),
+ * so a Get/Set round trip through the generic path does not move an attached camera.
+ */
+static FVector s_GetFrustumRelativePosition(const ACineCameraActor* FrustumCamera)
+{
+	if (!FrustumCamera || !FrustumCamera->GetRootComponent())
+		return FVector();
+
+	return FrustumCamera->GetRootComponent()->GetRelativeLocation();
+}
+
+FVector4 UStageAPIImpl::GetPropertyValue(EStageAPIProperty Property) const
+{
+	STAGEAPI_TRACE(GetPropertyValue)
+	STAGEAPI_JOURNAL(GetPropertyValue, Property)
+	//The stage getters are not const on the interface
+	UStageAPIImpl* MutableThis = const_cast<UStageAPIImpl*>(this);
+
+	switch (Property)
+	{
+	case EStageAPIProperty::StagePosition:				return FVector4(MutableThis->GetStagePosition(), 0);
+	case EStageAPIProperty::StageRotation:				return s_RotatorToVector4(MutableThis->GetStageLocalRotation());
+	case EStageAPIProperty::DefaultViewPosition:		return FVector4(GetDefaultViewPosition(), 0);
+	case EStageAPIProperty::StageExposure:				return FVector4(GetStageExposure(), 0, 0, 0);
+	case EStageAPIProperty::GlobalScreenPercentage:		return FVector4(GetGlobalScreenPercentage(), 0, 0, 0);
+	case EStageAPIProperty::InnerFrustumEnabled:		return FVector4(GetInnerFrustumStatus() ? 1 : 0, 0, 0, 0);
+	case EStageAPIProperty::ChromakeyEnabled:			return FVector4(GetChromakeyStatus() ? 1 : 0, 0, 0, 0);
+
+	case EStageAPIProperty::FrustumFOVMult:				return FVector4(GetFrustumFOVMult(), 0, 0, 0);
+	case EStageAPIProperty::FrustumExposure:			return FVector4(GetFrustumExposure(), 0, 0, 0);
+	case EStageAPIProperty::FrustumAperture:			return FVector4(GetFrustumAperture(), 0, 0, 0);
+	case EStageAPIProperty::FrustumFocalDistance:		return FVector4(GetFrustumFocalDistance(), 0, 0, 0);
+	case EStageAPIProperty::FrustumPosition:			return FVector4(s_GetFrustumRelativePosition(GetFrustumCamera_ByComponent(GetIcvfxCameraComponentA())), 0);
+	case EStageAPIProperty::FrustumRotation:			return s_RotatorToVector4(GetFrustumRotation());
+	case EStageAPIProperty::FrustumRenderRatio:			return FVector4(GetFrustumRenderRatio(), 0, 0, 0);
+
+	case EStageAPIProperty::FrustumFOVMultB:			return FVector4(GetFrustumFOVMultB(), 0, 0, 0);
+	case EStageAPIProperty::FrustumExposureB:			return FVector4(GetFrustumExposureB(), 0, 0, 0);
+	case EStageAPIProperty::FrustumApertureB:			return FVector4(GetFrustumApertureB(), 0, 0, 0);
+	case EStageAPIProperty::FrustumFocalDistanceB:		return FVector4(GetFrustumFocalDistanceB(), 0, 0, 0);
+	case EStageAPIProperty::FrustumPositionB:			return FVector4(s_GetFrustumRelativePosition(GetFrustumCamera_ByComponent(GetIcvfxCameraComponentB())), 0);
+	case EStageAPIProperty::FrustumRotationB:			return s_RotatorToVector4(GetFrustumRotationB());
+
+	case EStageAPIProperty::ClusterGlobalSaturation:	return GetClusterPP_GlobalSaturation();
+	case EStageAPIProperty::ClusterGlobalContrast:		return GetClusterPP_GlobalContrast();
+	case EStageAPIProperty::ClusterGlobalGamma:			return GetClusterPP_GlobalGamma();
+	case EStageAPIProperty::ClusterGlobalGain:			return GetClusterPP_GlobalGain();
+	case EStageAPIProperty::ClusterGlobalOffset:		return GetClusterPP_GlobalOffset();
+	case EStageAPIProperty::ClusterShadowsGain:			return GetClusterPP_ShadowsGain();
+	case EStageAPIProperty::ClusterMidsGain:			return GetClusterPP_MidsGain();
+	case EStageAPIProperty::ClusterHighlightsGain:		return GetClusterPP_HighlightsGain();
+
+	case EStageAPIProperty::FrustumGlobalSaturation:	return GetFrustumPP_GlobalSaturation();
+	case EStageAPIProperty::FrustumGlobalContrast:		return GetFrustumPP_GlobalContrast();
+	case EStageAPIProperty::FrustumGlobalGamma:			return GetFrustumPP_GlobalGamma();
+	case EStageAPIProperty::FrustumGlobalGain:			return GetFrustumPP_GlobalGain();
+	case EStageAPIProperty::FrustumGlobalOffset:		return GetFrustumPP_GlobalOffset();
+	case EStageAPIProperty::FrustumShadowsGain:			return GetFrustumPP_ShadowsGain();
+	case EStageAPIProperty::FrustumMidsGain:			return GetFrustumPP_MidsGain();
+	case EStageAPIProperty::FrustumHighlightsGain:		return GetFrustumPP_HighlightsGain();
+
+	default:
+		return FVector4();
+	}
+}
+
+void UStageAPIImpl::SetPropertyValue(EStageAPIProperty Property, FVector4 Value)
+{
+	STAGEAPI_TRACE(SetPropertyValue)
+	STAGEAPI_JOURNAL(SetPropertyValue, Property, Value)
+	switch (Property)
+	{
+	case EStageAPIProperty::StagePosition:				SetStageLocalPosition(FVector(Value)); break;
+	case EStageAPIProperty::StageRotation:				SetStageLocalRotation(s_Vector4ToRotator(Value)); break;
+	case EStageAPIProperty::DefaultViewPosition:		SetDefaultViewPosition(FVector(Value)); break;
+	case EStageAPIProperty::StageExposure:				SetStageExposure(Value.X); break;
+	case EStageAPIProperty::GlobalScreenPercentage:		SetGlobalScreenPercentage(Value.X); break;
+	case EStageAPIProperty::InnerFrustumEnabled:		SetInnerFrustumState(Value.X != 0); break;
+	case EStageAPIProperty::ChromakeyEnabled:			SetChromakeyStatus(Value.X != 0); break;
+
+	case EStageAPIProperty::FrustumFOVMult:				SetFrustumFOVMult(Value.X); break;
+	case EStageAPIProperty::FrustumExposure:			SetFrustumExposure(Value.X); break;
+	case EStageAPIProperty::FrustumAperture:			SetFrustumAperture(Value.X); break;
+	case EStageAPIProperty::FrustumFocalDistance:		SetFrustumFocalDistance(Value.X); break;
+	case EStageAPIProperty::FrustumPosition:			SetFrustumPosition(FVector(Value)); break;
+	case EStageAPIProperty::FrustumRotation:			SetFrustumRotation(s_Vector4ToRotator(Value)); break;
+	case EStageAPIProperty::FrustumRenderRatio:			SetFrustumRenderRatio(Value.X); break;
+
+	case EStageAPIProperty::FrustumFOVMultB:			SetFrustumFOVMultB(Value.X); break;
+	case EStageAPIProperty::FrustumExposureB:			SetFrustumExposureB(Value.X); break;
+	case EStageAPIProperty::FrustumApertureB:			SetFrustumApertureB(Value.X); break;
+	case EStageAPIProperty::FrustumFocalDistanceB:		SetFrustumFocalDistanceB(Value.X); break;
+	case EStageAPIProperty::FrustumPositionB:			SetFrustumPositionB(FVector(Value)); break;
+	case EStageAPIProperty::FrustumRotationB:			SetFrustumRotationB(s_Vector4ToRotator(Value)); break;
+
+	case EStageAPIProperty::ClusterGlobalSaturation:	SetClusterPP_GlobalSaturation(Value); break;
+	case EStageAPIProperty::ClusterGlobalContrast:		SetClusterPP_GlobalContrast(Value); break;
+	case EStageAPIProperty::ClusterGlobalGamma:			SetClusterPP_GlobalGamma(Value); break;
+	case EStageAPIProperty::ClusterGlobalGain:			SetClusterPP_GlobalGain(Value); break;
+	case EStageAPIProperty::ClusterGlobalOffset:		SetClusterPP_GlobalOffset(Value); break;
+	case EStageAPIProperty::ClusterShadowsGain:			SetClusterPP_ShadowsGain(Value); break;
+	case EStageAPIProperty::ClusterMidsGain:			SetClusterPP_MidsGain(Value); break;
+	case EStageAPIProperty::ClusterHighlightsGain:		SetClusterPP_HighlightsGain(Value); break;
+
+	case EStageAPIProperty::FrustumGlobalSaturation:	SetFrustumPP_GlobalSaturation(Value); break;
+	case EStageAPIProperty::FrustumGlobalContrast:		SetFrustumPP_GlobalContrast(Value); break;
+	case EStageAPIProperty::FrustumGlobalGamma:			SetFrustumPP_GlobalGamma(Value); break;
+	case EStageAPIProperty::FrustumGlobalGain:			SetFrustumPP_GlobalGain(Value); break;
+	case EStageAPIProperty::FrustumGlobalOffset:		SetFrustumPP_GlobalOffset(Value); break;
+	case EStageAPIProperty::FrustumShadowsGain:			SetFrustumPP_ShadowsGain(Value); break;
+	case EStageAPIProperty::FrustumMidsGain:			SetFrustumPP_MidsGain(Value); break;
+	case EStageAPIProperty::FrustumHighlightsGain:		SetFrustumPP_HighlightsGain(Value); break;
+
+	default:
+		break;
+	}
+}
+
+#pragma endregion
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+// WRITE COALESCING & INTERACTIONS
+//
+//With coalescing enabled each property has a single pending slot. Setters only overwrite the slot and the latest
+//value is applied once per flush (every editor tick, or at the configured rate) inside one transaction.
+//During an interaction flushes are applied locally without a transaction and EndInteraction commits only the final
+//values, so dragging a slider produces a single undo entry and a single Multi-User transaction.
+//////////////////////////////////////////////////////////////////////////////////////////////
+#pragma region "Write Coalescing"
+
+bool UStageAPIImpl::TryCoalesceWrite(EStageAPIProperty Property, const FVector4& Value)
+{
+	STAGEAPI_TRACE(TryCoalesceWrite)
+	//Writes aimed at a pushed target root apply immediately, the queue always flushes to the active root
+	if (bFlushingWrites || s_RootTargetStack.Num() > 0 || (!bWriteCoalescing && InteractionDepth == 0))
+		return false;
+
+	uint8 const PropertyIndex = static_cast<uint8>(Property);
+	if (!bPendingWrite[PropertyIndex])
+	{
+		bPendingWrite[PropertyIndex] = true;
+		++NumPendingWrites;
+	}
+	PendingWriteValues[PropertyIndex] = Value;
+	return true;
+}
+
+void UStageAPIImpl::ApplyPendingWrites(bool bLocalOnly)
+{
+	STAGEAPI_TRACE(ApplyPendingWrites)
+	if (NumPendingWrites == 0)
+		return;
+
+	TGuardValue<bool> FlushGuard(bFlushingWrites, true);
+	TGuardValue<int32> SuppressGuard(s_TransactionSuppressDepth, s_TransactionSuppressDepth + (bLocalOnly ? 1 : 0));
+
+	if (!bLocalOnly)
+	{
+		BeginBatch(TEXT("Update Stage Properties"));
+	}
+
+	for (EStageAPIProperty Property : TEnumRange<EStageAPIProperty>())
+	{
+		uint8 const PropertyIndex = static_cast<uint8>(Property);
+		if (!bPendingWrite[PropertyIndex])
+			continue;
+
+		bPendingWrite[PropertyIndex] = false;
+
+		//Remember where the interaction started so EndInteraction can record the full change
+		if (InteractionDepth > 0 && !InteractionOriginalValues.Contains(Property))
+		{
+			InteractionOriginalValues.Add(Property, GetPropertyValue(Property));
+		}
+
+		SetPropertyValue(Property, PendingWriteValues[PropertyIndex]);
+	}
+	NumPendingWrites = 0;
+
+	if (!bLocalOnly)
+	{
+		CommitBatch();
+	}
+}
+
+bool UStageAPIImpl::TickPendingWrites(float DeltaTime)
+{
+	STAGEAPI_TRACE(TickPendingWrites)
+	//Calls made from the ticker are part of an already journaled call
+	FStageAPIJournalScope JournalScope;
+	ApplyPendingWrites(InteractionDepth > 0);
+	return true;
+}
+
+void UStageAPIImpl::UpdatePendingWritesTicker()
+{
+	STAGEAPI_TRACE(UpdatePendingWritesTicker)
+	if (PendingWritesTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(PendingWritesTickerHandle);
+		PendingWritesTickerHandle.Reset();
+	}
+
+	if (bWriteCoalescing || InteractionDepth > 0)
+	{
+		float const TickerDelay = WriteFlushRate > 0 ? 1.0f / WriteFlushRate : 0.0f;
+		PendingWritesTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UStageAPIImpl::TickPendingWrites), TickerDelay);
+	}
+}
+
+void UStageAPIImpl::SetWriteCoalescing(bool bEnabled, float FlushRate)
+{
+	STAGEAPI_TRACE(SetWriteCoalescing)
+	STAGEAPI_JOURNAL(SetWriteCoalescing, bEnabled, FlushRate)
+	//Anything waiting under the old settings goes out now
+	if (bWriteCoalescing && !bEnabled && InteractionDepth == 0)
+	{
+		ApplyPendingWrites(false);
+	}
+
+	bWriteCoalescing = bEnabled;
+	WriteFlushRate = FMath::Max(FlushRate, 0.0f);
+	UpdatePendingWritesTicker();
+}
+
+bool UStageAPIImpl::IsWriteCoalescingEnabled() const
+{
+	STAGEAPI_TRACE(IsWriteCoalescingEnabled)
+	STAGEAPI_JOURNAL(IsWriteCoalescingEnabled)
+	return bWriteCoalescing;
+}
+
+void UStageAPIImpl::FlushPendingWrites()
+{
+	STAGEAPI_TRACE(FlushPendingWrites)
+	STAGEAPI_JOURNAL(FlushPendingWrites)
+	ApplyPendingWrites(InteractionDepth > 0);
+}
+
+template<typename TGradingBand>
+static uint32 s_ReadBandOverrides(const TGradingBand& Band)
+{
+	return (Band.bOverride_Saturation ? 1u : 0u) | (Band.bOverride_Contrast ? 2u : 0u) | (Band.bOverride_Gamma ? 4u : 0u)
+		| (Band.bOverride_Gain ? 8u : 0u) | (Band.bOverride_Offset ? 16u : 0u);
+}
+
+template<typename TGradingBand>
+static void s_WriteBandOverrides(uint32 Overrides, TGradingBand& OutBand)
+{
+	OutBand.bOverride_Saturation = (Overrides & 1u) != 0;
+	OutBand.bOverride_Contrast = (Overrides & 2u) != 0;
+	OutBand.bOverride_Gamma = (Overrides & 4u) != 0;
+	OutBand.bOverride_Gain = (Overrides & 8u) != 0;
+	OutBand.bOverride_Offset = (Overrides & 16u) != 0;
+}
+
+//Five bits per band, Global/Shadows/Midtones/Highlights from the lowest bits up
+template<typename TGradingSettings>
+static uint32 s_ReadGradingOverrides(const TGradingSettings& Settings)
+{
+	return s_ReadBandOverrides(Settings.Global) | s_ReadBandOverrides(Settings.Shadows) << 5
+		| s_ReadBandOverrides(Settings.Midtones) << 10 | s_ReadBandOverrides(Settings.Highlights) << 15;
+}
+
+template<typename TGradingSettings>
+static void s_WriteGradingOverrides(uint32 Overrides, TGradingSettings& OutSettings)
+{
+	s_WriteBandOverrides(Overrides, OutSettings.Global);
+	s_WriteBandOverrides(Overrides >> 5, OutSettings.Shadows);
+	s_WriteBandOverrides(Overrides >> 10, OutSettings.Midtones);
+	s_WriteBandOverrides(Overrides >> 15, OutSettings.Highlights);
+}
+
+/**
+ * @brief Snapshot of the enable and override flags of the target root's cluster grade and ICVFX cameras. The property
+ * values do not carry them, and the setters used to put a value back switch them on.
+ */
+UStageAPIImpl::FStageOverrideFlags UStageAPIImpl::CaptureOverrideFlags() const
+{
+	STAGEAPI_TRACE(CaptureOverrideFlags)
+	FStageOverrideFlags Flags;
+	if (!s_EnsureAPISurface())
+		return Flags;
+
+	Flags.Root = s_DisplayClusterRoot;
+	auto const& ClusterColorGrading = s_DisplayClusterRoot->GetConfigData()->StageSettings.EntireClusterColorGrading;
+	Flags.Cluster.bEnableGrading = ClusterColorGrading.bEnableEntireClusterColorGrading;
+	Flags.Cluster.bExposureOverride = ClusterColorGrading.ColorGradingSettings.bOverride_AutoExposureBias;
+	Flags.Cluster.BandOverrides = s_ReadGradingOverrides(ClusterColorGrading.ColorGradingSettings);
+
+	UDisplayClusterICVFXCameraComponent* const Cameras[2] = { GetIcvfxCameraComponentA(), GetIcvfxCameraComponentB() };
+	for (int32 CameraIdx = 0; CameraIdx < 2; ++CameraIdx)
+	{
+		Flags.Cameras[CameraIdx] = Cameras[CameraIdx];
+		if (!Cameras[CameraIdx])
+			continue;
+
+		auto const& CameraColorGrading = Cameras[CameraIdx]->CameraSettings.AllNodesColorGrading;
+		FGradingOverrideFlags& CameraFlags = Flags.CameraFlags[CameraIdx];
+		CameraFlags.bEnableGrading = CameraColorGrading.bEnableEntireClusterColorGrading;
+		CameraFlags.bEnableInnerFrustumGrading = CameraColorGrading.bEnableInnerFrustumAllNodesColorGrading;
+		CameraFlags.bExposureOverride = CameraColorGrading.ColorGradingSettings.bOverride_AutoExposureBias;
+		CameraFlags.BandOverrides = s_ReadGradingOverrides(CameraColorGrading.ColorGradingSettings);
+	}
+	return Flags;
+}
+
+/**
+ * @brief Writes flags captured by CaptureOverrideFlags back to the root and cameras they came from. Call it after the
+ * values have been put back, inside the transaction that should record the change if there is one.
+ */
+void UStageAPIImpl::RestoreOverrideFlags(const FStageOverrideFlags& Flags)
+{
+	STAGEAPI_TRACE(RestoreOverrideFlags)
+	ADisplayClusterRootActor* Root = Flags.Root.Get();
+	if (!Root)
+		return;
+
+	bool bChanged = false;
+	auto& ClusterColorGrading = Root->GetConfigData()->StageSettings.EntireClusterColorGrading;
+	if (ClusterColorGrading.bEnableEntireClusterColorGrading != Flags.Cluster.bEnableGrading
+		|| ClusterColorGrading.ColorGradingSettings.bOverride_AutoExposureBias != Flags.Cluster.bExposureOverride
+		|| s_ReadGradingOverrides(ClusterColorGrading.ColorGradingSettings) != Flags.Cluster.BandOverrides)
+	{
+		Root->GetConfigData()->Modify();
+		ClusterColorGrading.bEnableEntireClusterColorGrading = Flags.Cluster.bEnableGrading;
+		ClusterColorGrading.ColorGradingSettings.bOverride_AutoExposureBias = Flags.Cluster.bExposureOverride;
+		s_WriteGradingOverrides(Flags.Cluster.BandOverrides, ClusterColorGrading.ColorGradingSettings);
+		bChanged = true;
+	}
+
+	for (int32 CameraIdx = 0; CameraIdx < 2; ++CameraIdx)
+	{
+		UDisplayClusterICVFXCameraComponent* Camera = Flags.Cameras[CameraIdx].Get();
+		if (!Camera)
+			continue;
+
+		const FGradingOverrideFlags& CameraFlags = Flags.CameraFlags[CameraIdx];
+		auto& CameraColorGrading = Camera->CameraSettings.AllNodesColorGrading;
+		if (CameraColorGrading.bEnableEntireClusterColorGrading != CameraFlags.bEnableGrading
+			|| CameraColorGrading.bEnableInnerFrustumAllNodesColorGrading != CameraFlags.bEnableInnerFrustumGrading
+			|| CameraColorGrading.ColorGradingSettings.bOverride_AutoExposureBias != CameraFlags.bExposureOverride
+			|| s_ReadGradingOverrides(CameraColorGrading.ColorGradingSettings) != CameraFlags.BandOverrides)
+		{
+			Camera->Modify();
+			CameraColorGrading.bEnableEntireClusterColorGrading = CameraFlags.bEnableGrading;
+			CameraColorGrading.bEnableInnerFrustumAllNodesColorGrading = CameraFlags.bEnableInnerFrustumGrading;
+			CameraColorGrading.ColorGradingSettings.bOverride_AutoExposureBias = CameraFlags.bExposureOverride;
+			s_WriteGradingOverrides(CameraFlags.BandOverrides, CameraColorGrading.ColorGradingSettings);
+			bChanged = true;
+		}
+	}
+
+	if (bChanged)
+	{
+		s_NotifyStageChanged();
+	}
+}
+
+void UStageAPIImpl::BeginInteraction()
+{
+	STAGEAPI_TRACE(BeginInteraction)
+	STAGEAPI_JOURNAL(BeginInteraction)
+	if (InteractionDepth++ > 0)
+		return;
+
+	//Values set before the interaction started are not part of it
+	ApplyPendingWrites(false);
+	InteractionOriginalValues.Reset();
+	InteractionOriginalFlags = CaptureOverrideFlags();
+	UpdatePendingWritesTicker();
+}
+
+void UStageAPIImpl::EndInteraction()
+{
+	STAGEAPI_TRACE(EndInteraction)
+	STAGEAPI_JOURNAL(EndInteraction)
+	if (InteractionDepth == 0)
+	{
+		UE_LOG(StageAPIEditor, Warning, TEXT("VP Stage API EndInteraction called without a matching BeginInteraction"));
+		return;
+	}
+
+	if (InteractionDepth > 1)
+	{
+		--InteractionDepth;
+		return;
+	}
+
+	//Apply the last frame locally so the final values are what is on stage
+	ApplyPendingWrites(true);
+	InteractionDepth = 0;
+
+	TArray<TPair<EStageAPIProperty, FVector4>, TInlineAllocator<8>> FinalValues;
+	for (const TPair<EStageAPIProperty, FVector4>& Original : InteractionOriginalValues)
+	{
+		FinalValues.Emplace(Original.Key, GetPropertyValue(Original.Key));
+	}
+
+	if (FinalValues.Num() > 0)
+	{
+		FStageOverrideFlags const FinalFlags = CaptureOverrideFlags();
+		TGuardValue<bool> FlushGuard(bFlushingWrites, true);
+
+		//Put the starting values back untransacted so the transaction below records the whole interaction. The
+		//setters force overrides on, the flags go back raw as they were before the first write.
+		{
+			TGuardValue<int32> SuppressGuard(s_TransactionSuppressDepth, s_TransactionSuppressDepth + 1);
+			for (const TPair<EStageAPIProperty, FVector4>& Original : InteractionOriginalValues)
+			{
+				SetPropertyValue(Original.Key, Original.Value);
+			}
+			RestoreOverrideFlags(InteractionOriginalFlags);
+		}
+
+		BeginBatch(TEXT("Stage Interaction"));
+		for (const TPair<EStageAPIProperty, FVector4>& FinalValue : FinalValues)
+		{
+			SetPropertyValue(FinalValue.Key, FinalValue.Value);
+		}
+		RestoreOverrideFlags(FinalFlags);
+		CommitBatch();
+	}
+
+	InteractionOriginalValues.Reset();
+	InteractionOriginalFlags = FStageOverrideFlags();
+	UpdatePendingWritesTicker();
+}
+
+bool UStageAPIImpl::IsInteractionActive() const
+{
+	STAGEAPI_TRACE(IsInteractionActive)
+	STAGEAPI_JOURNAL(IsInteractionActive)
+	return InteractionDepth > 0;
+}
+
+#pragma endregion
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+// PREVIEW SESSIONS
+//
+//While a preview session is open every API setter is applied locally at frame rate with transactions suppressed.
+//The session snapshots every root up front, values and override flags, so writes through PushTargetRoot and the bulk
+//calls are covered as well. Commit sends only what differs from the snapshots as one transaction, Cancel restores
+//the snapshots. Roots added during the session are not part of it.
+//////////////////////////////////////////////////////////////////////////////////////////////
+#pragma region "Preview Sessions"
+
+//Grade bands are restored through the whole-grade setters so override flags come back exactly as they were
+static bool s_IsColorGradingProperty(EStageAPIProperty Property)
+{
+	return Property >= EStageAPIProperty::ClusterGlobalSaturation && Property <= EStageAPIProperty::FrustumHighlightsGain;
+}
+
+UStageAPIImpl::FPreviewSnapshot UStageAPIImpl::CapturePreviewSnapshot() const
+{
+	STAGEAPI_TRACE(CapturePreviewSnapshot)
+	FPreviewSnapshot Snapshot;
+	for (EStageAPIProperty Property : TEnumRange<EStageAPIProperty>())
+	{
+		if (Property != EStageAPIProperty::None && !s_IsColorGradingProperty(Property))
+		{
+			Snapshot.Values[static_cast<uint8>(Property)] = GetPropertyValue(Property);
+		}
+	}
+	Snapshot.ClusterGrading = GetClusterColorGrading();
+	Snapshot.FrustumGrading = GetFrustumColorGrading();
+	Snapshot.Flags = CaptureOverrideFlags();
+	return Snapshot;
+}
+
+/**
+ * @brief Records how the target root differs from its snapshot, then puts the snapshot back. Runs with transactions
+ * suppressed, the flags go back last because the setters used for the values switch them on.
+ */
+UStageAPIImpl::FPreviewChange UStageAPIImpl::RestorePreviewSnapshot(const FPreviewSnapshot& Snapshot)
+{
+	STAGEAPI_TRACE(RestorePreviewSnapshot)
+	FPreviewChange Change;
+	Change.Root = s_DisplayClusterRoot;
+	for (EStageAPIProperty Property : TEnumRange<EStageAPIProperty>())
+	{
+		if (Property == EStageAPIProperty::None || s_IsColorGradingProperty(Property))
+			continue;
+
+		FVector4 const CurrentValue = GetPropertyValue(Property);
+		if (CurrentValue != Snapshot.Values[static_cast<uint8>(Property)])
+		{
+			Change.Values.Emplace(Property, CurrentValue);
+		}
+	}
+	Change.ClusterGrading = GetClusterColorGrading();
+	Change.FrustumGrading = GetFrustumColorGrading();
+	Change.bClusterGradingChanged = Change.ClusterGrading != Snapshot.ClusterGrading;
+	Change.bFrustumGradingChanged = Change.FrustumGrading != Snapshot.FrustumGrading;
+	Change.Flags = CaptureOverrideFlags();
+	Change.bFlagsChanged = Change.Flags != Snapshot.Flags;
+
+	for (const TPair<EStageAPIProperty, FVector4>& ChangedValue : Change.Values)
+	{
+		SetPropertyValue(ChangedValue.Key, Snapshot.Values[static_cast<uint8>(ChangedValue.Key)]);
+	}
+	if (Change.bClusterGradingChanged)
+	{
+		SetClusterColorGrading(Snapshot.ClusterGrading);
+	}
+	if (Change.bFrustumGradingChanged)
+	{
+		SetFrustumColorGrading(Snapshot.FrustumGrading);
+	}
+	RestoreOverrideFlags(Snapshot.Flags);
+	return Change;
+}
+
+bool UStageAPIImpl::BeginPreviewSession()
+{
+	STAGEAPI_TRACE(BeginPreviewSession)
+	STAGEAPI_JOURNAL(BeginPreviewSession)
+	if (bPreviewSessionActive)
+	{
+		UE_LOG(StageAPIEditor, Warning, TEXT("VP Stage API preview session is already open"));
+		return false;
+	}
+
+	if (s_PreviewSessionOwner)
+	{
+		UE_LOG(StageAPIEditor, Warning, TEXT("VP Stage API preview session is already open on another API instance"));
+		return false;
+	}
+
+	if (!s_EnsureAPISurface())
+		return false;
+
+	//Anything still pending belongs to the state before the session
+	ApplyPendingWrites(InteractionDepth > 0);
+
+	s_EnsureRootRegistry();
+	PreviewSnapshots.Reset();
+	//Copied, the getters can trigger a registry rebuild
+	for (const TWeakObjectPtr<ADisplayClusterRootActor>& Root : TArray<TWeakObjectPtr<ADisplayClusterRootActor>>(s_DisplayClusterRoots))
+	{
+		if (!Root.IsValid())
+			continue;
+
+		s_RootTargetStack.Push(s_DisplayClusterRoot);
+		s_DisplayClusterRoot = Root;
+		PreviewSnapshots.Add(Root, CapturePreviewSnapshot());
+		s_DisplayClusterRoot = s_RootTargetStack.Pop(EAllowShrinking::No);
+	}
+
+	bPreviewSessionActive = true;
+	s_PreviewSessionOwner = this;
+	++s_TransactionSuppressDepth;
+	return true;
+}
+
+void UStageAPIImpl::EndPreviewSession(bool bCommit)
+{
+	STAGEAPI_TRACE(EndPreviewSession)
+	//Pending coalesced values are part of the preview
+	ApplyPendingWrites(true);
+
+	bPreviewSessionActive = false;
+	s_PreviewSessionOwner = nullptr;
+	--s_TransactionSuppressDepth;
+
+	TGuardValue<bool> FlushGuard(bFlushingWrites, true);
+
+	//Back to the snapshots without a transaction. On commit this makes the transaction below record the net change.
+	TArray<FPreviewChange> Changes;
+	{
+		TGuardValue<int32> SuppressGuard(s_TransactionSuppressDepth, s_TransactionSuppressDepth + 1);
+		for (const TPair<TWeakObjectPtr<ADisplayClusterRootActor>, FPreviewSnapshot>& Snapshot : PreviewSnapshots)
+		{
+			if (!Snapshot.Key.IsValid())
+				continue;
+
+			s_RootTargetStack.Push(s_DisplayClusterRoot);
+			s_DisplayClusterRoot = Snapshot.Key;
+			FPreviewChange Change = RestorePreviewSnapshot(Snapshot.Value);
+			s_DisplayClusterRoot = s_RootTargetStack.Pop(EAllowShrinking::No);
+
+			if (Change.HasChanges())
+			{
+				Changes.Add(MoveTemp(Change));
+			}
+		}
+	}
+	PreviewSnapshots.Reset();
+
+	if (!bCommit || Changes.Num() == 0)
+		return;
+
+	BeginBatch(TEXT("Commit Stage Preview"));
+	for (const FPreviewChange& Change : Changes)
+	{
+		s_RootTargetStack.Push(s_DisplayClusterRoot);
+		s_DisplayClusterRoot = Change.Root;
+		for (const TPair<EStageAPIProperty, FVector4>& ChangedValue : Change.Values)
+		{
+			SetPropertyValue(ChangedValue.Key, ChangedValue.Value);
+		}
+		if (Change.bClusterGradingChanged)
+		{
+			SetClusterColorGrading(Change.ClusterGrading);
+		}
+		if (Change.bFrustumGradingChanged)
+		{
+			SetFrustumColorGrading(Change.FrustumGrading);
+		}
+		//Also commits changes that only touched flags, e.g. DisableStageExposure
+		RestoreOverrideFlags(Change.Flags);
+		s_DisplayClusterRoot = s_RootTargetStack.Pop(EAllowShrinking::No);
+	}
+	CommitBatch();
+}
+
+void UStageAPIImpl::CommitPreviewSession()
+{
+	STAGEAPI_TRACE(CommitPreviewSession)
+	STAGEAPI_JOURNAL(CommitPreviewSession)
+	if (!bPreviewSessionActive)
+	{
+		UE_LOG(StageAPIEditor, Warning, TEXT("VP Stage API CommitPreviewSession called without an open preview session"));
+		return;
+	}
+
+	EndPreviewSession(true);
+}
+
+void UStageAPIImpl::CancelPreviewSession()
+{
+	STAGEAPI_TRACE(CancelPreviewSession)
+	STAGEAPI_JOURNAL(CancelPreviewSession)
+	if (!bPreviewSessionActive)
+	{
+		UE_LOG(StageAPIEditor, Warning, TEXT("VP Stage API CancelPreviewSession called without an open preview session"));
+		return;
+	}
+
+	EndPreviewSession(false);
+}
+
+bool UStageAPIImpl::IsPreviewSessionActive() const
+{
+	STAGEAPI_TRACE(IsPreviewSessionActive)
+	STAGEAPI_JOURNAL(IsPreviewSessionActive)
+	return bPreviewSessionActive;
+}
+
+#pragma endregion
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+// TRANSITIONS
+//
+//Timed, eased changes of a numeric property. Every tick the eased value is applied locally without a transaction.
+//When a transition ends the property is put back to where it started, again locally, and the end value is set
+//through the normal setter, so undo and Multi-User only ever see the start and end values.
+//////////////////////////////////////////////////////////////////////////////////////////////
+#pragma region "Transitions"
+
+static bool s_IsRotatorProperty(EStageAPIProperty Property)
+{
+	return Property == EStageAPIProperty::StageRotation
+		|| Property == EStageAPIProperty::FrustumRotation
+		|| Property == EStageAPIProperty::FrustumRotationB;
+}
+
+static FVector4 s_InterpolatePropertyValue(EStageAPIProperty Property, const FVector4& Start, const FVector4& Target, float Alpha)
+{
+	//Rotators take the shortest way round instead of unwinding through 360
+	if (s_IsRotatorProperty(Property))
+	{
+		FRotator const StartRotation = s_Vector4ToRotator(Start);
+		FRotator const Delta = (s_Vector4ToRotator(Target) - StartRotation).GetNormalized();
+		return s_RotatorToVector4(StartRotation + Delta * Alpha);
+	}
+	return Start + (Target - Start) * Alpha;
+}
+
+bool UStageAPIImpl::StartTransition(EStageAPIProperty Property, FVector4 TargetValue, float Duration, TEnumAsByte<EEasingFunc::Type> Easing, float BlendExp, int32 Steps)
+{
+	STAGEAPI_TRACE(StartTransition)
+	STAGEAPI_JOURNAL(StartTransition, Property, TargetValue, Duration, Easing, BlendExp, Steps)
+	API_CHECK_BOOL
+
+	if (Property == EStageAPIProperty::None || Property >= EStageAPIProperty::Count
+		|| Property == EStageAPIProperty::InnerFrustumEnabled || Property == EStageAPIProperty::ChromakeyEnabled)
+	{
+		UE_LOG(StageAPIEditor, Warning, TEXT("VP Stage API StartTransition called for a non-numeric property"));
+		return false;
+	}
+
+	//A queued write would land on top of the interpolated values, it becomes the start of the transition instead
+	uint8 const PropertyIndex = static_cast<uint8>(Property);
+	FVector4 StartValue = GetPropertyValue(Property);
+	if (bPendingWrite[PropertyIndex])
+	{
+		StartValue = PendingWriteValues[PropertyIndex];
+		bPendingWrite[PropertyIndex] = false;
+		--NumPendingWrites;
+	}
+
+	FTransition* Transition = Transitions.FindByPredicate([Property](const FTransition& Existing) { return Existing.Property == Property; });
+	if (!Transition)
+	{
+		Transition = &Transitions.AddDefaulted_GetRef();
+		Transition->Property = Property;
+		//Retargeting keeps the original value, the undo entry covers the whole chain
+		Transition->OriginalValue = GetPropertyValue(Property);
+		Transition->OriginalFlags = CaptureOverrideFlags();
+	}
+
+	Transition->StartValue = StartValue;
+	Transition->TargetValue = TargetValue;
+	Transition->StartTime = FPlatformTime::Seconds();
+	Transition->Duration = FMath::Max(Duration, 0.0f);
+	Transition->Easing = Easing;
+	Transition->BlendExp = BlendExp;
+	Transition->Steps = Steps;
+
+	//Apply the first frame now, a zero duration finishes on the spot
+	TickTransitions(0.0f);
+
+	if (Transitions.Num() > 0 && !TransitionsTickerHandle.IsValid())
+	{
+		TransitionsTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UStageAPIImpl::TickTransitions));
+	}
+	return true;
+}
+
+void UStageAPIImpl::CancelTransition(EStageAPIProperty Property, bool bJumpToEnd)
+{
+	STAGEAPI_TRACE(CancelTransition)
+	STAGEAPI_JOURNAL(CancelTransition, Property, bJumpToEnd)
+	int32 const TransitionIndex = Transitions.IndexOfByPredicate([Property](const FTransition& Transition) { return Transition.Property == Property; });
+	if (TransitionIndex == INDEX_NONE)
+		return;
+
+	FTransition const Transition = Transitions[TransitionIndex];
+	Transitions.RemoveAt(TransitionIndex);
+
+	//Stopping halfway still records the change made so far
+	FinishTransitions(MakeArrayView(&Transition, 1), bJumpToEnd);
+}
+
+void UStageAPIImpl::CancelAllTransitions(bool bJumpToEnd)
+{
+	STAGEAPI_TRACE(CancelAllTransitions)
+	STAGEAPI_JOURNAL(CancelAllTransitions, bJumpToEnd)
+	if (Transitions.Num() == 0)
+		return;
+
+	TArray<FTransition> CancelledTransitions = MoveTemp(Transitions);
+	Transitions.Reset();
+
+	FinishTransitions(CancelledTransitions, bJumpToEnd);
+}
+
+bool UStageAPIImpl::IsTransitionActive(EStageAPIProperty Property) const
+{
+	STAGEAPI_TRACE(IsTransitionActive)
+	STAGEAPI_JOURNAL(IsTransitionActive, Property)
+	return Transitions.ContainsByPredicate([Property](const FTransition& Transition) { return Transition.Property == Property; });
+}
+
+/**
+ * @brief Puts the original values and override flags back locally, then sets the end values through the setters so
+ * a single transaction records the whole transitions. The originals go back before the transaction opens, otherwise it
+ * would record the last intermediate frame as the starting state.
+ */
+void UStageAPIImpl::FinishTransitions(TArrayView<const FTransition> FinishedTransitions, bool bJumpToEnd)
+{
+	STAGEAPI_TRACE(FinishTransitions)
+	if (FinishedTransitions.Num() == 0)
+		return;
+
+	TGuardValue<bool> FlushGuard(bFlushingWrites, true);
+
+	//The end state is applied locally first, so the flags it leaves behind can be captured with the values
+	TArray<FVector4, TInlineAllocator<4>> EndValues;
+	{
+		TGuardValue<int32> SuppressGuard(s_TransactionSuppressDepth, s_TransactionSuppressDepth + 1);
+		for (const FTransition& Transition : FinishedTransitions)
+		{
+			if (bJumpToEnd)
+			{
+				SetPropertyValue(Transition.Property, Transition.TargetValue);
+			}
+			EndValues.Add(GetPropertyValue(Transition.Property));
+		}
+	}
+	FStageOverrideFlags const EndFlags = CaptureOverrideFlags();
+
+	//The frames went through the forcing setters, the flags go back raw
+	{
+		TGuardValue<int32> SuppressGuard(s_TransactionSuppressDepth, s_TransactionSuppressDepth + 1);
+		for (const FTransition& Transition : FinishedTransitions)
+		{
+			SetPropertyValue(Transition.Property, Transition.OriginalValue);
+			RestoreOverrideFlags(Transition.OriginalFlags);
+		}
+	}
+
+	BeginBatch(TEXT("Stage Transition"));
+	for (int32 TransitionIdx = 0; TransitionIdx < FinishedTransitions.Num(); ++TransitionIdx)
+	{
+		SetPropertyValue(FinishedTransitions[TransitionIdx].Property, EndValues[TransitionIdx]);
+	}
+	RestoreOverrideFlags(EndFlags);
+	CommitBatch();
+}
+
+bool UStageAPIImpl::TickTransitions(float DeltaTime)
+{
+	STAGEAPI_TRACE(TickTransitions)
+	//Calls made from the ticker are part of an already journaled call
+	FStageAPIJournalScope JournalScope;
+	if (!s_EnsureAPISurface())
+		return true;
+
+	double const Now = FPlatformTime::Seconds();
+	TArray<FTransition, TInlineAllocator<4>> FinishedTransitions;
+
+	//Intermediate frames are local only and bypass write coalescing
+	{
+		TGuardValue<bool> FlushGuard(bFlushingWrites, true);
+		TGuardValue<int32> SuppressGuard(s_TransactionSuppressDepth, s_TransactionSuppressDepth + 1);
+
+		for (int32 TransitionIdx = Transitions.Num() - 1; TransitionIdx >= 0; --TransitionIdx)
+		{
+			const FTransition& Transition = Transitions[TransitionIdx];
+			float const Alpha = Transition.Duration > 0.0f ? FMath::Clamp(static_cast<float>((Now - Transition.StartTime) / Transition.Duration), 0.0f, 1.0f) : 1.0f;
+			if (Alpha >= 1.0f)
+			{
+				FinishedTransitions.Add(Transition);
+				Transitions.RemoveAtSwap(TransitionIdx);
+				continue;
+			}
+
+			float const EasedAlpha = UKismetMathLibrary::Ease(0.0f, 1.0f, Alpha, Transition.Easing, Transition.BlendExp, Transition.Steps);
+			SetPropertyValue(Transition.Property, s_InterpolatePropertyValue(Transition.Property, Transition.StartValue, Transition.TargetValue, EasedAlpha));
+		}
+	}
+
+	//Transitions ending on the same frame share one transaction
+	FinishTransitions(FinishedTransitions, true);
+
+	//Also reached from StartTransition and outside the ticker, so the ticker is removed rather than returning false
+	if (Transitions.Num() == 0 && TransitionsTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TransitionsTickerHandle);
+		TransitionsTickerHandle.Reset();
+	}
+	return true;
+}
+
+#pragma endregion
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+// ROOT REGISTRY
+//
+//Stages with several nDisplay roots (e.g. one per volume). API calls target the active root, chosen with
+//SetActiveRoot. PushTargetRoot/PopTargetRoot retarget calls temporarily, the *OnRoot(s) calls wrap that for
+//the generic property access. Roots are keyed by actor name, actor label and tag.
+//////////////////////////////////////////////////////////////////////////////////////////////
+#pragma region "Root Registry"
+
+/**
+ * @brief Rebuilds the root lists and lookup maps from the world. Roots are sorted by actor name so the default
+ * selection and bulk call order are stable.
+ */
+void s_RebuildRootRegistry(UWorld* World)
+{
+	STAGEAPI_TRACE(s_RebuildRootRegistry)
+	s_DisplayClusterRoots.Reset();
+	s_RootsByName.Reset();
+	s_RootsByTag.Reset();
+	s_bRootRegistryDirty = false;
+
+	//Drop the caches of roots that have been destroyed since the last rebuild
+	for (auto It = s_StageTopologies.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid())
+			It.RemoveCurrent();
+	}
+	for (auto It = s_IcvfxCameraIndices.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid())
+			It.RemoveCurrent();
+	}
+	for (auto It = s_DefaultViewPointCache.Components.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid())
+			It.RemoveCurrent();
+	}
+	//Recompiled Blueprint root classes leave their old class behind
+	for (auto It = s_DefaultViewPointCache.Properties.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid())
+			It.RemoveCurrent();
+	}
+
+	if (!World)
+		return;
+
+	TArray<ADisplayClusterRootActor*, TInlineAllocator<4>> Roots;
+	for (TActorIterator<ADisplayClusterRootActor> It(World); It; ++It)
+	{
+		Roots.Add(*It);
+	}
+
+	Algo::Sort(Roots, [](const ADisplayClusterRootActor* A, const ADisplayClusterRootActor* B)
+	{
+		return A->GetFName().LexicalLess(B->GetFName());
+	});
+
+	for (ADisplayClusterRootActor* Root : Roots)
+	{
+		s_DisplayClusterRoots.Add(Root);
+		s_RootsByName.Add(Root->GetFName(), Root);
+	}
+
+	//Labels are what users see in the outliner but are not unique, the first root by name keeps the label
+	for (ADisplayClusterRootActor* Root : Roots)
+	{
+		FName const Label(*Root->GetActorLabel());
+		if (!s_RootsByName.Contains(Label))
+		{
+			s_RootsByName.Add(Label, Root);
+		}
+
+		for (const FName& Tag : Root->Tags)
+		{
+			s_RootsByTag.FindOrAdd(Tag).AddUnique(Root);
+		}
+	}
+}
+
+void s_EnsureRootRegistry()
+{
+	if (!s_bRootRegistryDirty)
+		return;
+
+	if (!s_GameWorldContext)
+	{
+		s_InitAPISurface();
+		return;
+	}
+
+	s_RebuildRootRegistry(GEngine->GetWorldFromContextObject(s_GameWorldContext, EGetWorldErrorMode::ReturnNull));
+}
+
+ADisplayClusterRootActor* s_FindRoot(FName RootName)
+{
+	s_EnsureRootRegistry();
+
+	const TWeakObjectPtr<ADisplayClusterRootActor>* Root = s_RootsByName.Find(RootName);
+	return Root ? Root->Get() : nullptr;
+}
+
+TArray<FName> UStageAPIImpl::GetRootNames() const
+{
+	STAGEAPI_TRACE(GetRootNames)
+	STAGEAPI_JOURNAL(GetRootNames)
+	s_EnsureRootRegistry();
+
+	TArray<FName> RootNames;
+	for (const TWeakObjectPtr<ADisplayClusterRootActor>& Root : s_DisplayClusterRoots)
+	{
+		if (Root.IsValid())
+		{
+			RootNames.Add(Root->GetFName());
+		}
+	}
+	return RootNames;
+}
+
+TArray<FName> UStageAPIImpl::GetRootNamesWithTag(FName Tag) const
+{
+	STAGEAPI_TRACE(GetRootNamesWithTag)
+	STAGEAPI_JOURNAL(GetRootNamesWithTag, Tag)
+	s_EnsureRootRegistry();
+
+	TArray<FName> RootNames;
+	if (const TArray<TWeakObjectPtr<ADisplayClusterRootActor>>* Roots = s_RootsByTag.Find(Tag))
+	{
+		for (const TWeakObjectPtr<ADisplayClusterRootActor>& Root : *Roots)
+		{
+			if (Root.IsValid())
+			{
+				RootNames.Add(Root->GetFName());
+			}
+		}
+	}
+	return RootNames;
+}
+
+ADisplayClusterRootActor* UStageAPIImpl::FindRoot(FName RootName) const
+{
+	STAGEAPI_TRACE(FindRoot)
+	STAGEAPI_JOURNAL(FindRoot, RootName)
+	return s_FindRoot(RootName);
+}
+
+bool UStageAPIImpl::SetActiveRoot(FName RootName)
+{
+	STAGEAPI_TRACE(SetActiveRoot)
+	STAGEAPI_JOURNAL(SetActiveRoot, RootName)
+	//The rescan would replace the pushed root and the pop would then restore the old active root over the new one
+	if (s_RootTargetStack.Num() > 0)
+	{
+		UE_LOG(StageAPIEditor, Warning, TEXT("VP Stage API cannot set the active root to '%s' while a target root is pushed"), *RootName.ToString());
+		return false;
+	}
+
+	ADisplayClusterRootActor* Root = s_FindRoot(RootName);
+	if (!Root)
+	{
+		UE_LOG(StageAPIEditor, Warning, TEXT("VP Stage API could not find nDisplay root '%s'"), *RootName.ToString());
+		return false;
+	}
+
+	s_ActiveRootName = Root->GetFName();
+	if (Root != s_DisplayClusterRoot.Get())
+	{
+		//Queued writes belong to the previous root
+		FlushPendingWrites();
+		s_InitAPISurface();
+	}
+	return true;
+}
+
+FName UStageAPIImpl::GetActiveRootName() const
+{
+	STAGEAPI_TRACE(GetActiveRootName)
+	STAGEAPI_JOURNAL(GetActiveRootName)
+	return s_DisplayClusterRoot.IsValid() ? s_DisplayClusterRoot->GetFName() : NAME_None;
+}
+
+bool UStageAPIImpl::PushTargetRoot(FName RootName)
+{
+	STAGEAPI_TRACE(PushTargetRoot)
+	STAGEAPI_JOURNAL(PushTargetRoot, RootName)
+	ADisplayClusterRootActor* Root = s_FindRoot(RootName);
+	if (!Root)
+	{
+		UE_LOG(StageAPIEditor, Warning, TEXT("VP Stage API could not find nDisplay root '%s'"), *RootName.ToString());
+		return false;
+	}
+
+	s_RootTargetStack.Push(s_DisplayClusterRoot);
+	s_DisplayClusterRoot = Root;
+	return true;
+}
+
+void UStageAPIImpl::PopTargetRoot()
+{
+	STAGEAPI_TRACE(PopTargetRoot)
+	STAGEAPI_JOURNAL(PopTargetRoot)
+	if (s_RootTargetStack.Num() == 0)
+	{
+		UE_LOG(StageAPIEditor, Warning, TEXT("VP Stage API PopTargetRoot called without a matching PushTargetRoot"));
+		return;
+	}
+
+	s_DisplayClusterRoot = s_RootTargetStack.Pop(EAllowShrinking::No);
+}
+
+FVector4 UStageAPIImpl::GetPropertyValueOnRoot(FName RootName, EStageAPIProperty Property)
+{
+	STAGEAPI_TRACE(GetPropertyValueOnRoot)
+	STAGEAPI_JOURNAL(GetPropertyValueOnRoot, RootName, Property)
+	if (!PushTargetRoot(RootName))
+		return FVector4();
+
+	FVector4 const Value = GetPropertyValue(Property);
+	PopTargetRoot();
+	return Value;
+}
+
+bool UStageAPIImpl::SetPropertyValueOnRoot(FName RootName, EStageAPIProperty Property, FVector4 Value)
+{
+	STAGEAPI_TRACE(SetPropertyValueOnRoot)
+	STAGEAPI_JOURNAL(SetPropertyValueOnRoot, RootName, Property, Value)
+	if (!PushTargetRoot(RootName))
+		return false;
+
+	SetPropertyValue(Property, Value);
+	PopTargetRoot();
+	return true;
+}
+
+/**
+ * @brief Applies a property to each root in the list inside one batch, so a bulk change is a single undo step and
+ * a single Multi-User transaction.
+ */
+void UStageAPIImpl::SetPropertyValueOnRoots(const TArray<TWeakObjectPtr<ADisplayClusterRootActor>>& Roots, EStageAPIProperty Property, const FVector4& Value)
+{
+	STAGEAPI_TRACE(SetPropertyValueOnRoots)
+	BeginBatch(TEXT("Update Stage Roots"));
+	for (const TWeakObjectPtr<ADisplayClusterRootActor>& Root : Roots)
+	{
+		if (!Root.IsValid())
+			continue;
+
+		s_RootTargetStack.Push(s_DisplayClusterRoot);
+		s_DisplayClusterRoot = Root;
+		SetPropertyValue(Property, Value);
+		s_DisplayClusterRoot = s_RootTargetStack.Pop(EAllowShrinking::No);
+	}
+	CommitBatch();
+}
+
+void UStageAPIImpl::SetPropertyValueOnAllRoots(EStageAPIProperty Property, FVector4 Value)
+{
+	STAGEAPI_TRACE(SetPropertyValueOnAllRoots)
+	STAGEAPI_JOURNAL(SetPropertyValueOnAllRoots, Property, Value)
+	s_EnsureRootRegistry();
+
+	//Copied, setters can trigger a registry rebuild
+	SetPropertyValueOnRoots(TArray<TWeakObjectPtr<ADisplayClusterRootActor>>(s_DisplayClusterRoots), Property, Value);
+}
+
+void UStageAPIImpl::SetPropertyValueOnRootsWithTag(FName Tag, EStageAPIProperty Property, FVector4 Value)
+{
+	STAGEAPI_TRACE(SetPropertyValueOnRootsWithTag)
+	STAGEAPI_JOURNAL(SetPropertyValueOnRootsWithTag, Tag, Property, Value)
+	s_EnsureRootRegistry();
+	if (const TArray<TWeakObjectPtr<ADisplayClusterRootActor>>* Roots = s_RootsByTag.Find(Tag))
+	{
+		SetPropertyValueOnRoots(TArray<TWeakObjectPtr<ADisplayClusterRootActor>>(*Roots), Property, Value);
+	}
+}
+
+#pragma endregion
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+// PRIVATE CAMERA FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////////////////////
+#pragma region "Private Camera Functions"
+
+ACineCameraActor* UStageAPIImpl::GetFrustumCamera_ByComponent(UDisplayClusterICVFXCameraComponent* IcvfxComponent) const
+{
+	STAGEAPI_TRACE(GetFrustumCamera_ByComponent)
+	STAGEAPI_JOURNAL(GetFrustumCamera_ByComponent, IcvfxComponent)
+	if (!IcvfxComponent)
+		return nullptr;
+
+	return IcvfxComponent->CameraSettings.ExternalCameraActor.Get();
+	
+}
+float UStageAPIImpl::GetFrustumFOVMult_ByComponent(UDisplayClusterICVFXCameraComponent* IcvfxComponent) const
+{
+	STAGEAPI_TRACE(GetFrustumFOVMult_ByComponent)
+	STAGEAPI_JOURNAL(GetFrustumFOVMult_ByComponent, IcvfxComponent)
+	if (!IcvfxComponent)
+		return 0;
+	
+	return IcvfxComponent->CameraSettings.BufferRatio;
+}
+void UStageAPIImpl::SetFrustumFOVMult_ByComponent(UDisplayClusterICVFXCameraComponent* IcvfxComponent, float FOVMult)
+{
+	STAGEAPI_TRACE(SetFrustumFOVMult_ByComponent)
+	STAGEAPI_JOURNAL(SetFrustumFOVMult_ByComponent, IcvfxComponent, FOVMult)
+	if (!IcvfxComponent)
+		return;
+
+	s_BeginTransaction(TEXT("Set Frustum FOV Mult"), s_DisplayClusterRoot.Get());
+
+	IcvfxComponent->Modify();
+	IcvfxComponent->CameraSettings.BufferRatio = FOVMult;
+
+	s_EndTransaction();
+	
+}
+float UStageAPIImpl::GetFrustumExposure_ByComponent(UDisplayClusterICVFXCameraComponent* IcvfxComponent) const
+{
+	STAGEAPI_TRACE(GetFrustumExposure_ByComponent)
+	STAGEAPI_JOURNAL(GetFrustumExposure_ByComponent, IcvfxComponent)
+	if (!IcvfxComponent)
+		return 0;
+
+	return IcvfxComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.AutoExposureBias;
+}
+float UStageAPIImpl::GetFrustumAperture_ByComponent(UDisplayClusterICVFXCameraComponent* IcvfxComponent) const
+{
+	STAGEAPI_TRACE(GetFrustumAperture_ByComponent)
+	STAGEAPI_JOURNAL(GetFrustumAperture_ByComponent, IcvfxComponent)
+	auto FrustumCamera = GetFrustumCamera_ByComponent(IcvfxComponent);
+
+	if (!FrustumCamera) return 0;
+
+	return FrustumCamera->GetCineCameraComponent()->CurrentAperture; 
+}
+void UStageAPIImpl::SetFrustumExposure_ByComponent(UDisplayClusterICVFXCameraComponent* IcvfxComponent, float FrustumExposure)
+{
+	STAGEAPI_TRACE(SetFrustumExposure_ByComponent)
+	STAGEAPI_JOURNAL(SetFrustumExposure_ByComponent, IcvfxComponent, FrustumExposure)
+	if (!IcvfxComponent)
+		return;
+
+	s_BeginTransaction(TEXT("Set Frustum FOV Mult"), s_DisplayClusterRoot.Get());
+
+	IcvfxComponent->Modify();
+	IcvfxComponent->CameraSettings.AllNodesColorGrading.bEnableEntireClusterColorGrading = true;
+	IcvfxComponent->CameraSettings.AllNodesColorGrading.bEnableInnerFrustumAllNodesColorGrading = true;
+	IcvfxComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.bOverride_AutoExposureBias = true;
+	IcvfxComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.AutoExposureBias = FrustumExposure;
+
+	s_EndTransaction();
+}
+void UStageAPIImpl::SetFrustumAperture_ByComponent(UDisplayClusterICVFXCameraComponent* IcvfxComponent, float FrustumAperture)
+{
+	STAGEAPI_TRACE(SetFrustumAperture_ByComponent)
+	STAGEAPI_JOURNAL(SetFrustumAperture_ByComponent, IcvfxComponent, FrustumAperture)
+	auto FrustumCamera = GetFrustumCamera_ByComponent(IcvfxComponent);
+
+	if (!FrustumCamera) return;
+
+	s_BeginTransaction(TEXT("Update frustum aperture"), FrustumCamera);
+
+	FrustumCamera->GetCineCameraComponent()->Modify();
+	FrustumCamera->GetCineCameraComponent()->CurrentAperture = FrustumAperture;
+	
+	s_EndTransaction();
+	
+}
+void UStageAPIImpl::SetFrustumFocalDistance_ByComponent(UDisplayClusterICVFXCameraComponent* IcvfxComponent,float FocalDistance)
+{
+	STAGEAPI_TRACE(SetFrustumFocalDistance_ByComponent)
+	STAGEAPI_JOURNAL(SetFrustumFocalDistance_ByComponent, IcvfxComponent, FocalDistance)
+	auto FrustumCamera = GetFrustumCamera_ByComponent(IcvfxComponent);
+
+	if (!FrustumCamera)
+		return;
+
+	s_BeginTransaction(TEXT("Update frustum focal distance"), FrustumCamera);
+
+	FrustumCamera->GetCineCameraComponent()->Modify();
+	FrustumCamera->GetCineCameraComponent()->FocusSettings.ManualFocusDistance = FocalDistance;
+	
+	s_EndTransaction();
+}
+
+float UStageAPIImpl::GetFrustumFocalDistance_ByComponent(UDisplayClusterICVFXCameraComponent* IcvfxComponent) const
+{
+	STAGEAPI_TRACE(GetFrustumFocalDistance_ByComponent)
+	STAGEAPI_JOURNAL(GetFrustumFocalDistance_ByComponent, IcvfxComponent)
+	auto FrustumCamera = GetFrustumCamera_ByComponent(IcvfxComponent);
+
+	if (!FrustumCamera)
+		return  0;
+
+	return FrustumCamera->GetCineCameraComponent()->FocusSettings.ManualFocusDistance;
+}
+FRotator UStageAPIImpl::GetFrustumRotation_ByComponent(UDisplayClusterICVFXCameraComponent* IcvfxComponent) const
+{
+	STAGEAPI_TRACE(GetFrustumRotation_ByComponent)
+	STAGEAPI_JOURNAL(GetFrustumRotation_ByComponent, IcvfxComponent)
+	auto frustumCamera = GetFrustumCamera_ByComponent(IcvfxComponent);
+	if (!frustumCamera)
+		return  FRotator();
+
+	return frustumCamera->GetRootComponent()->GetRelativeRotation();
+}
+void UStageAPIImpl::SetFrustumRotation_ByComponent(UDisplayClusterICVFXCameraComponent* IcvfxComponent,FRotator NewRotation)
+{
+	STAGEAPI_TRACE(SetFrustumRotation_ByComponent)
+	STAGEAPI_JOURNAL(SetFrustumRotation_ByComponent, IcvfxComponent, NewRotation)
+	auto FrustumCamera = GetFrustumCamera_ByComponent(IcvfxComponent);
+
+	if (!FrustumCamera)
+		return;
+
+	s_BeginTransaction(TEXT("Set Frustum Rotation"), FrustumCamera);
+	FrustumCamera->SetActorRotation(NewRotation,ETeleportType::None);
+	FrustumCamera->GetRootComponent()->Modify();
+	FrustumCamera->GetRootComponent()->SetRelativeRotation(NewRotation);
+	FrustumCamera->Modify();
+	s_EndTransaction();
+}
+void UStageAPIImpl::SetFrustumRotationPreview_ByComponent(UDisplayClusterICVFXCameraComponent* IcvfxComponent,FRotator NewRotation)
+{
+	STAGEAPI_TRACE(SetFrustumRotationPreview_ByComponent)
+	STAGEAPI_JOURNAL(SetFrustumRotationPreview_ByComponent, IcvfxComponent, NewRotation)
+	auto FrustumCamera = GetFrustumCamera_ByComponent(IcvfxComponent);
+
+	if (!FrustumCamera)
+		return;
+
+	FrustumCamera->SetActorRotation(NewRotation,ETeleportType::None);
+
+	s_NotifyStageChanged();
+}
+FVector UStageAPIImpl::GetFrustumPosition_ByComponent(UDisplayClusterICVFXCameraComponent* IcvfxComponent) const
+{
+	STAGEAPI_TRACE(GetFrustumPosition_ByComponent)
+	STAGEAPI_JOURNAL(GetFrustumPosition_ByComponent, IcvfxComponent)
+	auto frustumCamera = GetFrustumCamera_ByComponent(IcvfxComponent);
+	if (!frustumCamera)
+		return  FVector();
+
+	return frustumCamera->GetRootComponent()->GetComponentLocation();
+}
+void UStageAPIImpl::SetFrustumPosition_ByComponent(UDisplayClusterICVFXCameraComponent* IcvfxComponent, FVector NewPosition)
+{
+	STAGEAPI_TRACE(SetFrustumPosition_ByComponent)
+	STAGEAPI_JOURNAL(SetFrustumPosition_ByComponent, IcvfxComponent, NewPosition)
 	auto FrustumCamera = GetFrustumCamera_ByComponent(IcvfxComponent);
 
 	if (!FrustumCamera)
 		return;
 
-	GEngine->BeginTransaction(*FString(TEXT(TEXT_API_TAG)), FText::FromString(TEXT("Set Frustum Rotation")), FrustumCamera);
+	s_BeginTransaction(TEXT("Set Frustum Rotation"), FrustumCamera);
 	FrustumCamera->GetRootComponent()->Modify();
 	FrustumCamera->GetRootComponent()->SetRelativeLocation(NewPosition);
 	FrustumCamera->Modify();
-	GEngine->EndTransaction();
+	s_EndTransaction();
 }
 void UStageAPIImpl::SetFrustumPositionPreview_ByComponent(UDisplayClusterICVFXCameraComponent* IcvfxComponent, FVector NewPosition)
 {
+	STAGEAPI_TRACE(SetFrustumPositionPreview_ByComponent)
+	STAGEAPI_JOURNAL(SetFrustumPositionPreview_ByComponent, IcvfxComponent, NewPosition)
 	auto FrustumCamera = GetFrustumCamera_ByComponent(IcvfxComponent);
 
 	if (!FrustumCamera)
 		return;
 
 	FrustumCamera->GetRootComponent()->SetRelativeLocation(NewPosition);
+
+	s_NotifyStageChanged();
 }
 
 #pragma endregion
@@ -366,90 +2387,132 @@ void UStageAPIImpl::SetFrustumPositionPreview_ByComponent(UDisplayClusterICVFXCa
 
 bool UStageAPIImpl::CameraBActive() const
 {
-	return (!(GetIcvfxCameraComponentA() == GetIcvfxCameraComponentB()));
+	STAGEAPI_TRACE(CameraBActive)
+	STAGEAPI_JOURNAL(CameraBActive)
+	API_CHECK_BOOL
+
+	const FIcvfxCameraIndex& CameraIndex = s_GetIcvfxCameraIndex(s_DisplayClusterRoot.Get());
+	return CameraIndex.CameraA != CameraIndex.CameraB;
 }
 
 ACineCameraActor* UStageAPIImpl::GetFrustumCamera() const
 {
+	STAGEAPI_TRACE(GetFrustumCamera)
+	STAGEAPI_JOURNAL(GetFrustumCamera)
 	API_CHECK_NULL
 	return GetFrustumCamera_ByComponent(GetIcvfxCameraComponentA());
 }
 ACineCameraActor* UStageAPIImpl::GetFrustumCameraB() const
 {
+	STAGEAPI_TRACE(GetFrustumCameraB)
+	STAGEAPI_JOURNAL(GetFrustumCameraB)
 	API_CHECK_NULL
 	return GetFrustumCamera_ByComponent(GetIcvfxCameraComponentB());
 }
 
 float UStageAPIImpl::GetFrustumFOVMult() const
 {
+	STAGEAPI_TRACE(GetFrustumFOVMult)
+	STAGEAPI_JOURNAL(GetFrustumFOVMult)
 	API_CHECK_FLOAT
 	return  GetFrustumFOVMult_ByComponent(GetIcvfxCameraComponentA());
 
 }
 float UStageAPIImpl::GetFrustumFOVMultB() const
 {
+	STAGEAPI_TRACE(GetFrustumFOVMultB)
+	STAGEAPI_JOURNAL(GetFrustumFOVMultB)
 	API_CHECK_FLOAT
 	return  GetFrustumFOVMult_ByComponent(GetIcvfxCameraComponentB());
 }
 
 void UStageAPIImpl::SetFrustumFOVMult(float FOVMult)
 {
+	STAGEAPI_TRACE(SetFrustumFOVMult)
+	STAGEAPI_JOURNAL(SetFrustumFOVMult, FOVMult)
 	API_CHECK_VOID
+	API_COALESCE(EStageAPIProperty::FrustumFOVMult, FVector4(FOVMult, 0, 0, 0))
 	SetFrustumFOVMult_ByComponent(GetIcvfxCameraComponentA(),FOVMult);
 }
 void UStageAPIImpl::SetFrustumFOVMultB(float FOVMult)
 {
+	STAGEAPI_TRACE(SetFrustumFOVMultB)
+	STAGEAPI_JOURNAL(SetFrustumFOVMultB, FOVMult)
 	API_CHECK_VOID
+	API_COALESCE(EStageAPIProperty::FrustumFOVMultB, FVector4(FOVMult, 0, 0, 0))
 	SetFrustumFOVMult_ByComponent(GetIcvfxCameraComponentB(),FOVMult);
 }
 
 float UStageAPIImpl::GetFrustumExposure() const
 {
+	STAGEAPI_TRACE(GetFrustumExposure)
+	STAGEAPI_JOURNAL(GetFrustumExposure)
 	API_CHECK_FLOAT
 	return  GetFrustumExposure_ByComponent(GetIcvfxCameraComponentA());
 }
 float UStageAPIImpl::GetFrustumExposureB() const
 {
+	STAGEAPI_TRACE(GetFrustumExposureB)
+	STAGEAPI_JOURNAL(GetFrustumExposureB)
 	API_CHECK_FLOAT
 	return  GetFrustumExposure_ByComponent(GetIcvfxCameraComponent());
 }
 
 float UStageAPIImpl::GetFrustumAperture() const
 {
+	STAGEAPI_TRACE(GetFrustumAperture)
+	STAGEAPI_JOURNAL(GetFrustumAperture)
 	API_CHECK_FLOAT
 	return GetFrustumAperture_ByComponent(GetIcvfxCameraComponentA());
 }
 float UStageAPIImpl::GetFrustumApertureB() const
 {
+	STAGEAPI_TRACE(GetFrustumApertureB)
+	STAGEAPI_JOURNAL(GetFrustumApertureB)
 	API_CHECK_FLOAT
 	return GetFrustumAperture_ByComponent(GetIcvfxCameraComponentB());
 }
 
 void UStageAPIImpl::SetFrustumExposure(float FrustumExposure)
 {
+	STAGEAPI_TRACE(SetFrustumExposure)
+	STAGEAPI_JOURNAL(SetFrustumExposure, FrustumExposure)
 	API_CHECK_VOID
+	API_COALESCE(EStageAPIProperty::FrustumExposure, FVector4(FrustumExposure, 0, 0, 0))
 	SetFrustumExposure_ByComponent(GetIcvfxCameraComponentA(), FrustumExposure);
 }
 void UStageAPIImpl::SetFrustumExposureB(float FrustumExposure)
 {
+	STAGEAPI_TRACE(SetFrustumExposureB)
+	STAGEAPI_JOURNAL(SetFrustumExposureB, FrustumExposure)
 	API_CHECK_VOID
+	API_COALESCE(EStageAPIProperty::FrustumExposureB, FVector4(FrustumExposure, 0, 0, 0))
 	SetFrustumExposure_ByComponent(GetIcvfxCameraComponentB(), FrustumExposure);
 }
 
 void UStageAPIImpl::SetFrustumAperture(float FrustumAperture)
 {
+	STAGEAPI_TRACE(SetFrustumAperture)
+	STAGEAPI_JOURNAL(SetFrustumAperture, FrustumAperture)
 	API_CHECK_VOID
+	API_COALESCE(EStageAPIProperty::FrustumAperture, FVector4(FrustumAperture, 0, 0, 0))
 	SetFrustumAperture_ByComponent(GetIcvfxCameraComponentA(), FrustumAperture);
 }
 void UStageAPIImpl::SetFrustumApertureB(float FrustumAperture)
 {
+	STAGEAPI_TRACE(SetFrustumApertureB)
+	STAGEAPI_JOURNAL(SetFrustumApertureB, FrustumAperture)
 	API_CHECK_VOID
+	API_COALESCE(EStageAPIProperty::FrustumApertureB, FVector4(FrustumAperture, 0, 0, 0))
 	SetFrustumAperture_ByComponent(GetIcvfxCameraComponentB(), FrustumAperture);
 }
 
 void UStageAPIImpl::SetFrustumFocalDistance(float FocalDistance)
 {
+	STAGEAPI_TRACE(SetFrustumFocalDistance)
+	STAGEAPI_JOURNAL(SetFrustumFocalDistance, FocalDistance)
 	API_CHECK_VOID
+	API_COALESCE(EStageAPIProperty::FrustumFocalDistance, FVector4(FocalDistance, 0, 0, 0))
 	SetFrustumFocalDistance_ByComponent(GetIcvfxCameraComponentA(), FocalDistance);
 
 	//Call any listeners to focal distance changes
@@ -461,7 +2524,10 @@ void UStageAPIImpl::SetFrustumFocalDistance(float FocalDistance)
 }
 void UStageAPIImpl::SetFrustumFocalDistanceB(float FocalDistance)
 {
+	STAGEAPI_TRACE(SetFrustumFocalDistanceB)
+	STAGEAPI_JOURNAL(SetFrustumFocalDistanceB, FocalDistance)
 	API_CHECK_VOID
+	API_COALESCE(EStageAPIProperty::FrustumFocalDistanceB, FVector4(FocalDistance, 0, 0, 0))
 	SetFrustumFocalDistance_ByComponent(GetIcvfxCameraComponentB(), FocalDistance);
 
 	//TODO: Implement focal dist listner for Camera B
@@ -476,11 +2542,15 @@ void UStageAPIImpl::SetFrustumFocalDistanceB(float FocalDistance)
 
 float UStageAPIImpl::GetFrustumFocalDistance() const
 {
+	STAGEAPI_TRACE(GetFrustumFocalDistance)
+	STAGEAPI_JOURNAL(GetFrustumFocalDistance)
 	API_CHECK_FLOAT
 	return GetFrustumFocalDistance_ByComponent(GetIcvfxCameraComponentA());
 }
 float UStageAPIImpl::GetFrustumFocalDistanceB() const
 {
+	STAGEAPI_TRACE(GetFrustumFocalDistanceB)
+	STAGEAPI_JOURNAL(GetFrustumFocalDistanceB)
 	API_CHECK_FLOAT
 	return GetFrustumFocalDistance_ByComponent(GetIcvfxCameraComponentB());
 }
@@ -488,61 +2558,87 @@ float UStageAPIImpl::GetFrustumFocalDistanceB() const
 
 FRotator UStageAPIImpl::GetFrustumRotation() const
 {
+	STAGEAPI_TRACE(GetFrustumRotation)
+	STAGEAPI_JOURNAL(GetFrustumRotation)
 	API_CHECK_ROTATOR
 	return  GetFrustumRotation_ByComponent(GetIcvfxCameraComponentA());
 }
 FRotator UStageAPIImpl::GetFrustumRotationB() const
 {
+	STAGEAPI_TRACE(GetFrustumRotationB)
+	STAGEAPI_JOURNAL(GetFrustumRotationB)
 	API_CHECK_ROTATOR
 	return  GetFrustumRotation_ByComponent(GetIcvfxCameraComponentB());
 }
 
 void UStageAPIImpl::SetFrustumRotation(FRotator NewRotation)
 {
+	STAGEAPI_TRACE(SetFrustumRotation)
+	STAGEAPI_JOURNAL(SetFrustumRotation, NewRotation)
 	API_CHECK_VOID
+	API_COALESCE(EStageAPIProperty::FrustumRotation, s_RotatorToVector4(NewRotation))
 	SetFrustumRotation_ByComponent(GetIcvfxCameraComponentA(), NewRotation);
 }
 void UStageAPIImpl::SetFrustumRotationB(FRotator NewRotation)
 {
+	STAGEAPI_TRACE(SetFrustumRotationB)
+	STAGEAPI_JOURNAL(SetFrustumRotationB, NewRotation)
 	API_CHECK_VOID
+	API_COALESCE(EStageAPIProperty::FrustumRotationB, s_RotatorToVector4(NewRotation))
 	SetFrustumRotation_ByComponent(GetIcvfxCameraComponentB(), NewRotation);
 }
 
 void UStageAPIImpl::SetFrustumRotationPreview(FRotator NewRotation)
 {
+	STAGEAPI_TRACE(SetFrustumRotationPreview)
+	STAGEAPI_JOURNAL(SetFrustumRotationPreview, NewRotation)
 	API_CHECK_VOID
 	SetFrustumRotationPreview_ByComponent(GetIcvfxCameraComponentA(),NewRotation);
 }
 void UStageAPIImpl::SetFrustumRotationPreviewB(FRotator NewRotation)
 {
+	STAGEAPI_TRACE(SetFrustumRotationPreviewB)
+	STAGEAPI_JOURNAL(SetFrustumRotationPreviewB, NewRotation)
 	API_CHECK_VOID
 	SetFrustumRotationPreview_ByComponent(GetIcvfxCameraComponentB(),NewRotation);
 }
 
 FVector UStageAPIImpl::GetFrustumPosition() const
 {
+	STAGEAPI_TRACE(GetFrustumPosition)
+	STAGEAPI_JOURNAL(GetFrustumPosition)
 	API_CHECK_VECTOR
 	return GetFrustumPosition_ByComponent(GetIcvfxCameraComponentA());
 }
 FVector UStageAPIImpl::GetFrustumPositionB() const
 {
+	STAGEAPI_TRACE(GetFrustumPositionB)
+	STAGEAPI_JOURNAL(GetFrustumPositionB)
 	API_CHECK_VECTOR
 	return GetFrustumPosition_ByComponent(GetIcvfxCameraComponentB());
 }
 
 void UStageAPIImpl::SetFrustumPosition(FVector NewPosition)
 {
+	STAGEAPI_TRACE(SetFrustumPosition)
+	STAGEAPI_JOURNAL(SetFrustumPosition, NewPosition)
 	API_CHECK_VOID
+	API_COALESCE(EStageAPIProperty::FrustumPosition, FVector4(NewPosition, 0))
 	SetFrustumPosition_ByComponent(GetIcvfxCameraComponentA(), NewPosition);
 }
 void UStageAPIImpl::SetFrustumPositionB(FVector NewPosition)
 {
+	STAGEAPI_TRACE(SetFrustumPositionB)
+	STAGEAPI_JOURNAL(SetFrustumPositionB, NewPosition)
 	API_CHECK_VOID
+	API_COALESCE(EStageAPIProperty::FrustumPositionB, FVector4(NewPosition, 0))
 	SetFrustumPosition_ByComponent(GetIcvfxCameraComponentB(), NewPosition);
 }
 
 void UStageAPIImpl::SetFrustumPositionPreview(FVector NewPosition)
 {
+	STAGEAPI_TRACE(SetFrustumPositionPreview)
+	STAGEAPI_JOURNAL(SetFrustumPositionPreview, NewPosition)
 	API_CHECK_VOID
 	SetFrustumPositionPreview_ByComponent(GetIcvfxCameraComponentA(), NewPosition);
 }
@@ -550,6 +2646,8 @@ void UStageAPIImpl::SetFrustumPositionPreview(FVector NewPosition)
 //TODO: Update this function to the same layout as other ICVFX calls
 float UStageAPIImpl::GetFrustumRenderRatio() const
 {
+	STAGEAPI_TRACE(GetFrustumRenderRatio)
+	STAGEAPI_JOURNAL(GetFrustumRenderRatio)
 	API_CHECK_FLOAT
 
 	auto ICVFXCamera = GetIcvfxCameraComponent();
@@ -564,25 +2662,30 @@ float UStageAPIImpl::GetFrustumRenderRatio() const
 //TODO: Update this function to the same layout as other ICVFX calls
 void UStageAPIImpl::SetFrustumRenderRatio(float ScreenPercentage)
 {
+	STAGEAPI_TRACE(SetFrustumRenderRatio)
+	STAGEAPI_JOURNAL(SetFrustumRenderRatio, ScreenPercentage)
 	API_CHECK_VOID
+	API_COALESCE(EStageAPIProperty::FrustumRenderRatio, FVector4(ScreenPercentage, 0, 0, 0))
 
 	auto ICVFXCamera = GetIcvfxCameraComponent();
 
 	if (!ICVFXCamera)
 		return;
 
-	GEngine->BeginTransaction(*FString(TEXT("VP Stage API Editor API")), FText::FromString(TEXT("Set ICVFX Screen Percentage")), s_DisplayClusterRoot.Get());
+	s_BeginTransaction(TEXT("Set ICVFX Screen Percentage"), s_DisplayClusterRoot.Get());
 
 	ICVFXCamera->Modify();
 	//ICVFXCamera->CameraSettings.BufferRatio = ScreenPercentage;
 	ICVFXCamera->CameraSettings.RenderSettings.AdvancedRenderSettings.RenderTargetRatio = ScreenPercentage;
 
-	GEngine->EndTransaction();
+	s_EndTransaction();
 	
 }
 
 void UStageAPIImpl::SetFrustumPositionPreviewB(FVector NewPosition)
 {
+	STAGEAPI_TRACE(SetFrustumPositionPreviewB)
+	STAGEAPI_JOURNAL(SetFrustumPositionPreviewB, NewPosition)
 	API_CHECK_VOID
 	SetFrustumPositionPreview_ByComponent(GetIcvfxCameraComponentB(), NewPosition);
 }
@@ -610,6 +2713,8 @@ void UStageAPIImpl::SetFrustumPositionPreviewB(FVector NewPosition)
 ////** Gets the Display Cluster Root Actor. */
 ADisplayClusterRootActor* UStageAPIImpl::GetDisplayClusterRoot() const
 {
+	STAGEAPI_TRACE(GetDisplayClusterRoot)
+	STAGEAPI_JOURNAL(GetDisplayClusterRoot)
 	API_CHECK_NULL
 
 	return s_DisplayClusterRoot.Get();
@@ -617,16 +2722,22 @@ ADisplayClusterRootActor* UStageAPIImpl::GetDisplayClusterRoot() const
 
 void UStageAPIImpl::DisableInnerFrustum()
 {
+	STAGEAPI_TRACE(DisableInnerFrustum)
+	STAGEAPI_JOURNAL(DisableInnerFrustum)
 	SetInnerFrustumState(false);
 }
 
 void UStageAPIImpl::EnableInnerFrustum()
 {
+	STAGEAPI_TRACE(EnableInnerFrustum)
+	STAGEAPI_JOURNAL(EnableInnerFrustum)
 	SetInnerFrustumState(true);
 }
 
 bool UStageAPIImpl::GetInnerFrustumStatus() const
 {
+	STAGEAPI_TRACE(GetInnerFrustumStatus)
+	STAGEAPI_JOURNAL(GetInnerFrustumStatus)
 	API_CHECK_BOOL
 
 	return s_DisplayClusterRoot->GetConfigData()->StageSettings.bEnableInnerFrustums;
@@ -634,81 +2745,91 @@ bool UStageAPIImpl::GetInnerFrustumStatus() const
 
 void UStageAPIImpl::SetInnerFrustumState(bool NewInnerFrustumState)
 {
+	STAGEAPI_TRACE(SetInnerFrustumState)
+	STAGEAPI_JOURNAL(SetInnerFrustumState, NewInnerFrustumState)
 	API_CHECK_VOID
+	API_COALESCE(EStageAPIProperty::InnerFrustumEnabled, FVector4(NewInnerFrustumState ? 1 : 0, 0, 0, 0))
 
-	GEngine->BeginTransaction(*FString(TEXT(TEXT_API_TAG)), FText::FromString(TEXT("Enable/disable inner frustums")), s_DisplayClusterRoot.Get());
+	s_BeginTransaction(TEXT("Enable/disable inner frustums"), s_DisplayClusterRoot.Get());
 
 	s_DisplayClusterRoot->GetConfigData()->Modify();
 	s_DisplayClusterRoot->GetConfigData()->StageSettings.bEnableInnerFrustums = NewInnerFrustumState;
 
-	GEngine->EndTransaction();
+	s_EndTransaction();
 }
 
 
 UDisplayClusterICVFXCameraComponent* UStageAPIImpl::GetIcvfxCameraComponent() const
 {
+	STAGEAPI_TRACE(GetIcvfxCameraComponent)
+	STAGEAPI_JOURNAL(GetIcvfxCameraComponent)
 	return GetIcvfxCameraComponentA();
 }
 
 UDisplayClusterICVFXCameraComponent* UStageAPIImpl::GetIcvfxCameraComponentA() const
 {
+	STAGEAPI_TRACE(GetIcvfxCameraComponentA)
+	STAGEAPI_JOURNAL(GetIcvfxCameraComponentA)
 	API_CHECK_NULL
 
-	TArray<UDisplayClusterICVFXCameraComponent*> AvaliablleICVFXComponents;
-	s_DisplayClusterRoot->GetComponents<UDisplayClusterICVFXCameraComponent>(AvaliablleICVFXComponents,false);
-	
-	UDisplayClusterICVFXCameraComponent* ReturnICVFXComponent = nullptr;
-
-	//We grab the first component if avaliable or the one with the highest priority order
-	for (auto ICVFXComponent : AvaliablleICVFXComponents) 
-	{
-		if (ICVFXComponent->CameraSettings.bEnable)
-		{
-			if (!ReturnICVFXComponent)
-				ReturnICVFXComponent = ICVFXComponent;
-			else
-			{
-				if(ICVFXComponent->CameraSettings.RenderSettings.RenderOrder > ReturnICVFXComponent->CameraSettings.RenderSettings.RenderOrder)
-					ReturnICVFXComponent = ICVFXComponent;
-			}
-		}
-	}
-	return ReturnICVFXComponent;
+	//Camera A is the enabled component with the highest priority order
+	return s_GetIcvfxCameraIndex(s_DisplayClusterRoot.Get()).CameraA.Get();
 }
 
 UDisplayClusterICVFXCameraComponent* UStageAPIImpl::GetIcvfxCameraComponentB() const
 {
+	STAGEAPI_TRACE(GetIcvfxCameraComponentB)
+	STAGEAPI_JOURNAL(GetIcvfxCameraComponentB)
 	API_CHECK_NULL
 
-	TArray<UDisplayClusterICVFXCameraComponent*> AvaliablleICVFXComponents;
-	s_DisplayClusterRoot->GetComponents<UDisplayClusterICVFXCameraComponent>(AvaliablleICVFXComponents,false);
-	
-	UDisplayClusterICVFXCameraComponent* ReturnICVFXComponent = nullptr;
-
-	//We grab the first component if avaliable or the one with the lowest priority order
-	for (auto ICVFXComponent : AvaliablleICVFXComponents) 
-	{
-		if (ICVFXComponent->CameraSettings.bEnable)
-		{
-			if (!ReturnICVFXComponent)
-				ReturnICVFXComponent = ICVFXComponent;
-			else
-			{
-				if(ICVFXComponent->CameraSettings.RenderSettings.RenderOrder < ReturnICVFXComponent->CameraSettings.RenderSettings.RenderOrder)
-					ReturnICVFXComponent = ICVFXComponent;
-			}
-		}
-	}
-	return ReturnICVFXComponent;
+	//Camera B is the enabled component with the lowest priority order
+	return s_GetIcvfxCameraIndex(s_DisplayClusterRoot.Get()).CameraB.Get();
 }
 
 TArray<FString> UStageAPIImpl::GetViewportNames() const
 {
-	return s_ViewPorts;
+	STAGEAPI_TRACE(GetViewportNames)
+	STAGEAPI_JOURNAL(GetViewportNames)
+	API_CHECK_ARRAY
+
+	return s_GetStageTopology(s_DisplayClusterRoot.Get()).ViewportNameStrings;
+}
+
+TArray<FString> UStageAPIImpl::GetClusterNodeNames() const
+{
+	STAGEAPI_TRACE(GetClusterNodeNames)
+	STAGEAPI_JOURNAL(GetClusterNodeNames)
+	API_CHECK_ARRAY
+
+	return s_GetStageTopology(s_DisplayClusterRoot.Get()).NodeNameStrings;
+}
+
+FString UStageAPIImpl::GetViewportNodeName(const FString& ViewportName) const
+{
+	STAGEAPI_TRACE(GetViewportNodeName)
+	STAGEAPI_JOURNAL(GetViewportNodeName, ViewportName)
+	API_CHECK_STRING
+
+	const FStageTopology& Topology = s_GetStageTopology(s_DisplayClusterRoot.Get());
+	const int32* ViewportIdx = Topology.ViewportIndex.Find(FName(*ViewportName, FNAME_Find));
+	return ViewportIdx ? Topology.NodeNameStrings[Topology.ViewportNode[*ViewportIdx]] : FString();
+}
+
+int32 UStageAPIImpl::GetTopologyGeneration() const
+{
+	STAGEAPI_TRACE(GetTopologyGeneration)
+	STAGEAPI_JOURNAL(GetTopologyGeneration)
+	if (s_EnsureAPISurface())
+	{
+		return static_cast<int32>(s_GetStageTopology(s_DisplayClusterRoot.Get()).Generation);
+	}
+	return 0;
 }
 
 float UStageAPIImpl::GetGlobalScreenPercentage() const
 {
+	STAGEAPI_TRACE(GetGlobalScreenPercentage)
+	STAGEAPI_JOURNAL(GetGlobalScreenPercentage)
 	API_CHECK_FLOAT
 
 	auto ClusterConfiguration = GetDisplayClusterRoot()->GetConfigData();
@@ -721,20 +2842,25 @@ float UStageAPIImpl::GetGlobalScreenPercentage() const
 
 void UStageAPIImpl::SetGlobalScreenPercentage(float NewGlobalScreenPercentage)
 {
+	STAGEAPI_TRACE(SetGlobalScreenPercentage)
+	STAGEAPI_JOURNAL(SetGlobalScreenPercentage, NewGlobalScreenPercentage)
 	API_CHECK_VOID
+	API_COALESCE(EStageAPIProperty::GlobalScreenPercentage, FVector4(NewGlobalScreenPercentage, 0, 0, 0))
 
 	auto ClusterConfiguration = GetDisplayClusterRoot()->GetConfigData();
 
-	GEngine->BeginTransaction(*FString(TEXT(TEXT_API_TAG)), FText::FromString(TEXT("Set Global Screen Percentage")), s_DisplayClusterRoot.Get());
+	s_BeginTransaction(TEXT("Set Global Screen Percentage"), s_DisplayClusterRoot.Get());
 
 	ClusterConfiguration->Modify();
 	ClusterConfiguration->RenderFrameSettings.ClusterICVFXOuterViewportBufferRatioMult = NewGlobalScreenPercentage;
 	
-	GEngine->EndTransaction();
+	s_EndTransaction();
 }
 
 void UStageAPIImpl::SetStageLocation(FVector StagePosition, FRotator StageRotation)
 {
+	STAGEAPI_TRACE(SetStageLocation)
+	STAGEAPI_JOURNAL(SetStageLocation, StagePosition, StageRotation)
 	API_CHECK_VOID
 
 	//Look to see if the DCR is has a parent, which is going to be the stage root
@@ -742,48 +2868,53 @@ void UStageAPIImpl::SetStageLocation(FVector StagePosition, FRotator StageRotati
 
 	if(StageRoot)
 	{
-		GEngine->BeginTransaction(*FString(TEXT(TEXT_API_TAG)), FText::FromString(TEXT("Update Stage Location")), StageRoot);
+		s_BeginTransaction(TEXT("Update Stage Location"), StageRoot);
 		StageRoot->Modify();
 		StageRoot->SetActorLocation(StagePosition);
 		StageRoot->SetActorRotation(StageRotation);
-		GEngine->EndTransaction();
+		s_EndTransaction();
 	}
 	else
 	{
-		GEngine->BeginTransaction(*FString(TEXT(TEXT_API_TAG)), FText::FromString(TEXT("Update Stage Location")), s_DisplayClusterRoot.Get());
+		s_BeginTransaction(TEXT("Update Stage Location"), s_DisplayClusterRoot.Get());
 		s_DisplayClusterRoot->Modify();
 		s_DisplayClusterRoot->SetActorLocation(StagePosition);
 		s_DisplayClusterRoot->SetActorRotation(StageRotation);
-		GEngine->EndTransaction();
+		s_EndTransaction();
 	}
 
 }
 
 void UStageAPIImpl::SetStageLocalPosition(FVector StagePosition)
 {
+	STAGEAPI_TRACE(SetStageLocalPosition)
+	STAGEAPI_JOURNAL(SetStageLocalPosition, StagePosition)
 	API_CHECK_VOID
+	API_COALESCE(EStageAPIProperty::StagePosition, FVector4(StagePosition, 0))
 
 //Look to see if the DCR is has a parent, which is going to be the stage root
 auto StageRoot = GetDisplayClusterRoot()->GetAttachParentActor();
 
 	if(StageRoot)
 	{
-		GEngine->BeginTransaction(*FString(TEXT(TEXT_API_TAG)), FText::FromString(TEXT("Update Stage Location")), StageRoot);
+		s_BeginTransaction(TEXT("Update Stage Location"), StageRoot);
 		StageRoot->Modify();
 		StageRoot->SetActorLocation(StagePosition);
-		GEngine->EndTransaction();
+		s_EndTransaction();
 	}
 	else
 	{
-		GEngine->BeginTransaction(*FString(TEXT(TEXT_API_TAG)), FText::FromString(TEXT("Update Stage Location")), s_DisplayClusterRoot.Get());
+		s_BeginTransaction(TEXT("Update Stage Location"), s_DisplayClusterRoot.Get());
 		s_DisplayClusterRoot->Modify();
 		s_DisplayClusterRoot->SetActorLocation(StagePosition);
-		GEngine->EndTransaction();
+		s_EndTransaction();
 	}
 }
 
 void UStageAPIImpl::AddStageLocalOffset(FVector DeltaLocation)
 {
+	STAGEAPI_TRACE(AddStageLocalOffset)
+	STAGEAPI_JOURNAL(AddStageLocalOffset, DeltaLocation)
 	API_CHECK_VOID
 
 //Look to see if the DCR is has a parent, which is going to be the stage root
@@ -792,23 +2923,26 @@ void UStageAPIImpl::AddStageLocalOffset(FVector DeltaLocation)
 	
 	if(StageRoot)
 	{
-		GEngine->BeginTransaction(*FString(TEXT(TEXT_API_TAG)), FText::FromString(TEXT("Update Stage Location")), StageRoot);
+		s_BeginTransaction(TEXT("Update Stage Location"), StageRoot);
 		StageRoot->Modify();
 		StageRoot->K2_AddActorLocalOffset(DeltaLocation,false,HitResult,true);
-		GEngine->EndTransaction();
+		s_EndTransaction();
 	}
 	else
 	{
-		GEngine->BeginTransaction(*FString(TEXT(TEXT_API_TAG)), FText::FromString(TEXT("Update Stage Location")), s_DisplayClusterRoot.Get());
+		s_BeginTransaction(TEXT("Update Stage Location"), s_DisplayClusterRoot.Get());
 		s_DisplayClusterRoot->Modify();
 		s_DisplayClusterRoot->K2_AddActorLocalOffset(DeltaLocation,false,HitResult,true);
-		GEngine->EndTransaction();
+		s_EndTransaction();
 	}
 }
 
 void UStageAPIImpl::SetStageLocalRotation(FRotator StageRotation)
 {
+	STAGEAPI_TRACE(SetStageLocalRotation)
+	STAGEAPI_JOURNAL(SetStageLocalRotation, StageRotation)
 	API_CHECK_VOID
+	API_COALESCE(EStageAPIProperty::StageRotation, s_RotatorToVector4(StageRotation))
 
 	//Look to see if the DCR is has a parent, which is going to be the stage root
 	auto StageRoot = GetDisplayClusterRoot()->GetAttachParentActor();
@@ -817,23 +2951,25 @@ void UStageAPIImpl::SetStageLocalRotation(FRotator StageRotation)
 
 	if(StageRoot)
 	{
-		GEngine->BeginTransaction(*FString(TEXT(TEXT_API_TAG)), FText::FromString(TEXT("Update Stage Location")), StageRoot);
+		s_BeginTransaction(TEXT("Update Stage Location"), StageRoot);
 		StageRoot->Modify();
 		StageRoot->SetActorRotation(StageRotation);
 		StageRoot->GetRootComponent()->K2_SetWorldRotation(StageRotation,false,HitResult,true);
-		GEngine->EndTransaction();
+		s_EndTransaction();
 	}
 	else
 	{
-		GEngine->BeginTransaction(*FString(TEXT(TEXT_API_TAG)), FText::FromString(TEXT("Update Stage Location")), s_DisplayClusterRoot.Get());
+		s_BeginTransaction(TEXT("Update Stage Location"), s_DisplayClusterRoot.Get());
 		s_DisplayClusterRoot->Modify();
 		s_DisplayClusterRoot->GetRootComponent()->K2_SetWorldRotation(StageRotation,false,HitResult,true);
-		GEngine->EndTransaction();
+		s_EndTransaction();
 	}
 }
 
 FRotator UStageAPIImpl::GetStageLocalRotation()
 {
+	STAGEAPI_TRACE(GetStageLocalRotation)
+	STAGEAPI_JOURNAL(GetStageLocalRotation)
 	API_CHECK_ROTATOR
 
 	//Look to see if the DCR is has a parent, which is going to be the stage root
@@ -851,6 +2987,8 @@ auto const StageRoot = GetDisplayClusterRoot()->GetAttachParentActor();
 
 FRotator UStageAPIImpl::GetStageWorldRotation()
 {
+	STAGEAPI_TRACE(GetStageWorldRotation)
+	STAGEAPI_JOURNAL(GetStageWorldRotation)
 	API_CHECK_ROTATOR
 
 //Look to see if the DCR is has a parent, which is going to be the stage root
@@ -862,88 +3000,321 @@ auto const StageRoot = GetDisplayClusterRoot()->GetAttachParentActor();
 	}
 	else
 	{
-		return s_DisplayClusterRoot->GetRootComponent()->K2_GetComponentRotation();
+		return s_DisplayClusterRoot->GetRootComponent()->K2_GetComponentRotation();
+	}
+}
+
+void UStageAPIImpl::SetStageWorldRotation(FRotator StageRotation)
+{
+	STAGEAPI_TRACE(SetStageWorldRotation)
+	STAGEAPI_JOURNAL(SetStageWorldRotation, StageRotation)
+	API_CHECK_VOID
+
+	s_NotifyStageChanged();
+
+	FHitResult HitResult;
+
+//Look to see if the DCR is has a parent, which is going to be the stage root
+auto const StageRoot = GetDisplayClusterRoot()->GetAttachParentActor();
+
+	if(StageRoot)
+	{
+		return  StageRoot->GetRootComponent()->K2_SetWorldRotation(StageRotation,false, HitResult, true);
+	}
+	else
+	{
+		return s_DisplayClusterRoot->GetRootComponent()->K2_SetWorldRotation(StageRotation,false, HitResult, true);
+	}
+}
+
+FVector UStageAPIImpl::GetStagePosition()
+{
+	STAGEAPI_TRACE(GetStagePosition)
+	STAGEAPI_JOURNAL(GetStagePosition)
+	API_CHECK_VECTOR
+
+	auto const StageRoot = GetDisplayClusterRoot()->GetAttachParentActor();
+
+	if(StageRoot)
+	{
+		return  StageRoot->K2_GetActorLocation();
+	}
+	else
+	{
+		return s_DisplayClusterRoot->K2_GetActorLocation();
+	}
+	
+}
+
+FVector UStageAPIImpl::GetDefaultViewPosition() const
+{
+	STAGEAPI_TRACE(GetDefaultViewPosition)
+	STAGEAPI_JOURNAL(GetDefaultViewPosition)
+	API_CHECK_VECTOR
+	
+	UDisplayClusterCameraComponent* DefaultViewPoint = s_GetDefaultViewPoint(s_DisplayClusterRoot.Get());
+	if (DefaultViewPoint)
+	{
+		return DefaultViewPoint->GetRelativeLocation();
+		//return DefaultViewPoint->GetRelativeTransform().GetLocation();
+	}
+	return FVector();
+}
+
+void UStageAPIImpl::SetDefaultViewPosition(FVector NewPosition)
+{
+	STAGEAPI_TRACE(SetDefaultViewPosition)
+	STAGEAPI_JOURNAL(SetDefaultViewPosition, NewPosition)
+	API_CHECK_VOID
+	API_COALESCE(EStageAPIProperty::DefaultViewPosition, FVector4(NewPosition, 0))
+
+	UDisplayClusterCameraComponent* DefaultViewPoint = s_GetDefaultViewPoint(s_DisplayClusterRoot.Get());
+	if (DefaultViewPoint)
+	{
+		s_BeginTransaction(TEXT("Update Default View Location"), s_DisplayClusterRoot.Get());
+		DefaultViewPoint->Modify();
+		DefaultViewPoint->SetRelativeLocation(NewPosition);
+		//DefaultViewPoint->GetRelativeTransform().SetLocation(NewPosition);
+		s_EndTransaction();
+	}
+}
+
+void UStageAPIImpl::SetDefaultViewPositionPreview(FVector NewPosition)
+{
+	STAGEAPI_TRACE(SetDefaultViewPositionPreview)
+	STAGEAPI_JOURNAL(SetDefaultViewPositionPreview, NewPosition)
+	API_CHECK_VOID
+
+	//A queued transactional write would otherwise land on top of the tracked position
+	uint8 const PropertyIndex = static_cast<uint8>(EStageAPIProperty::DefaultViewPosition);
+	if (bPendingWrite[PropertyIndex])
+	{
+		bPendingWrite[PropertyIndex] = false;
+		--NumPendingWrites;
+	}
+
+	UDisplayClusterCameraComponent* DefaultViewPoint = s_GetDefaultViewPoint(s_DisplayClusterRoot.Get());
+	if (DefaultViewPoint)
+	{
+		DefaultViewPoint->SetRelativeLocation(NewPosition);
+	}
+
+	s_NotifyStageChanged();
+}
+
+
+
+
+#pragma endregion //END nDisplay API
+
+
+
+#pragma region "Viewport Render Settings"
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+// Viewport Render Settings & Render Tiers
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief Built in tiers. "full" renders every viewport at full resolution, "rehearsal" halves everything and
+ * "ceiling-low" halves viewports with "ceiling" in their name while keeping the walls at full resolution.
+ */
+static const TMap<FName, FStageAPIRenderTier>& s_GetBuiltInRenderTiers()
+{
+	static const TMap<FName, FStageAPIRenderTier> BuiltInTiers = []()
+	{
+		auto MakeEntry = [](const TCHAR* Pattern, float Ratio)
+		{
+			FStageAPIRenderTierEntry Entry;
+			Entry.ViewportPattern = Pattern;
+			Entry.Settings.BufferRatio = Ratio;
+			return Entry;
+		};
+
+		TMap<FName, FStageAPIRenderTier> Tiers;
+		Tiers.Add(TEXT("full")).Entries.Add(MakeEntry(TEXT("*"), 1.0f));
+		Tiers.Add(TEXT("rehearsal")).Entries.Add(MakeEntry(TEXT("*"), 0.5f));
+
+		FStageAPIRenderTier& CeilingLow = Tiers.Add(TEXT("ceiling-low"));
+		CeilingLow.Entries.Add(MakeEntry(TEXT("*ceiling*"), 0.5f));
+		CeilingLow.Entries.Add(MakeEntry(TEXT("*"), 1.0f));
+		return Tiers;
+	}();
+
+	return BuiltInTiers;
+}
+
+static FStageAPIViewportRenderSettings s_ReadViewportRenderSettings(const UDisplayClusterConfigurationViewport* Viewport)
+{
+	FStageAPIViewportRenderSettings Settings;
+	Settings.BufferRatio = Viewport->RenderSettings.BufferRatio;
+	Settings.RenderTargetRatio = Viewport->RenderSettings.RenderTargetRatio;
+	return Settings;
+}
+
+/**
+ * @brief Writes the settings to a viewport, touching (and recording) it only if something changes.
+ * Must be called inside a transaction.
+ */
+static void s_WriteViewportRenderSettings(UDisplayClusterConfigurationViewport* Viewport, const FStageAPIViewportRenderSettings& Settings)
+{
+	if (!Viewport || s_ReadViewportRenderSettings(Viewport) == Settings)
+		return;
+
+	Viewport->Modify();
+	Viewport->RenderSettings.BufferRatio = Settings.BufferRatio;
+	Viewport->RenderSettings.RenderTargetRatio = Settings.RenderTargetRatio;
+}
+
+FStageAPIViewportRenderSettings UStageAPIImpl::GetViewportRenderSettings(const FString& ViewportName) const
+{
+	STAGEAPI_TRACE(GetViewportRenderSettings)
+	STAGEAPI_JOURNAL(GetViewportRenderSettings, ViewportName)
+	if (!s_EnsureAPISurface())
+		return FStageAPIViewportRenderSettings();
+
+	const FStageTopology& Topology = s_GetStageTopology(s_DisplayClusterRoot.Get());
+	const int32* ViewportIdx = Topology.ViewportIndex.Find(FName(*ViewportName, FNAME_Find));
+	UDisplayClusterConfigurationViewport* Viewport = ViewportIdx ? Topology.ViewportObjects[*ViewportIdx].Get() : nullptr;
+
+	return Viewport ? s_ReadViewportRenderSettings(Viewport) : FStageAPIViewportRenderSettings();
+}
+
+void UStageAPIImpl::SetViewportRenderSettings(const TArray<FString>& ViewportNames, FStageAPIViewportRenderSettings Settings)
+{
+	STAGEAPI_TRACE(SetViewportRenderSettings)
+	STAGEAPI_JOURNAL(SetViewportRenderSettings, ViewportNames, Settings)
+	API_CHECK_VOID
+
+	const FStageTopology& Topology = s_GetStageTopology(s_DisplayClusterRoot.Get());
+
+	s_BeginTransaction(TEXT("Set Viewport Render Settings"), s_DisplayClusterRoot.Get());
+	for (const FString& ViewportName : ViewportNames)
+	{
+		if (const int32* ViewportIdx = Topology.ViewportIndex.Find(FName(*ViewportName, FNAME_Find)))
+		{
+			s_WriteViewportRenderSettings(Topology.ViewportObjects[*ViewportIdx].Get(), Settings);
+		}
+		else
+		{
+			UE_LOG(StageAPIEditor, Warning, TEXT("VP Stage API could not find viewport '%s'"), *ViewportName);
+		}
 	}
+	s_EndTransaction();
 }
 
-void UStageAPIImpl::SetStageWorldRotation(FRotator StageRotation)
+void UStageAPIImpl::SetNodeRenderSettings(const FString& NodeName, FStageAPIViewportRenderSettings Settings)
 {
+	STAGEAPI_TRACE(SetNodeRenderSettings)
+	STAGEAPI_JOURNAL(SetNodeRenderSettings, NodeName, Settings)
 	API_CHECK_VOID
 
-	FHitResult HitResult;
-
-//Look to see if the DCR is has a parent, which is going to be the stage root
-auto const StageRoot = GetDisplayClusterRoot()->GetAttachParentActor();
-
-	if(StageRoot)
+	const FStageTopology& Topology = s_GetStageTopology(s_DisplayClusterRoot.Get());
+	const int32* NodeIdx = Topology.NodeIndex.Find(FName(*NodeName, FNAME_Find));
+	if (!NodeIdx)
 	{
-		return  StageRoot->GetRootComponent()->K2_SetWorldRotation(StageRotation,false, HitResult, true);
+		UE_LOG(StageAPIEditor, Warning, TEXT("VP Stage API could not find cluster node '%s'"), *NodeName);
+		return;
 	}
-	else
+
+	s_BeginTransaction(TEXT("Set Node Render Settings"), s_DisplayClusterRoot.Get());
+	for (int32 ViewportIdx = Topology.NodeViewportStart[*NodeIdx]; ViewportIdx < Topology.NodeViewportStart[*NodeIdx + 1]; ++ViewportIdx)
 	{
-		return s_DisplayClusterRoot->GetRootComponent()->K2_SetWorldRotation(StageRotation,false, HitResult, true);
+		s_WriteViewportRenderSettings(Topology.ViewportObjects[ViewportIdx].Get(), Settings);
 	}
+	s_EndTransaction();
 }
 
-FVector UStageAPIImpl::GetStagePosition()
+void UStageAPIImpl::SetRenderTier(FName TierName, const FStageAPIRenderTier& Tier)
 {
-	API_CHECK_VECTOR
-
-	auto const StageRoot = GetDisplayClusterRoot()->GetAttachParentActor();
+	STAGEAPI_TRACE(SetRenderTier)
+	STAGEAPI_JOURNAL(SetRenderTier, TierName, Tier)
+	RenderTiers.Add(TierName, Tier);
+	ResolvedRenderTiers.Remove(TierName);
+}
 
-	if(StageRoot)
-	{
-		return  StageRoot->K2_GetActorLocation();
-	}
-	else
+TArray<FName> UStageAPIImpl::GetRenderTierNames() const
+{
+	STAGEAPI_TRACE(GetRenderTierNames)
+	STAGEAPI_JOURNAL(GetRenderTierNames)
+	TArray<FName> TierNames;
+	s_GetBuiltInRenderTiers().GetKeys(TierNames);
+	for (const TPair<FName, FStageAPIRenderTier>& Tier : RenderTiers)
 	{
-		return s_DisplayClusterRoot->K2_GetActorLocation();
+		TierNames.AddUnique(Tier.Key);
 	}
-	
+	return TierNames;
 }
 
-FVector UStageAPIImpl::GetDefaultViewPosition() const
+/**
+ * @brief Matches the tier's patterns against the viewports once per topology generation, so switching tiers is a
+ * walk over a prebuilt list instead of wildcard matching every viewport name.
+ */
+const UStageAPIImpl::FResolvedRenderTier* UStageAPIImpl::ResolveRenderTier(FName TierName, const FStageTopology& Topology)
 {
-	API_CHECK_VECTOR
-	
-	FObjectProperty* DefaultViewPoint_Property = CastField<FObjectProperty>(s_DisplayClusterRoot->GetClass()->FindPropertyByName("DefaultViewPoint"));
-	
-	if (DefaultViewPoint_Property)
+	STAGEAPI_TRACE(ResolveRenderTier)
+	const FStageAPIRenderTier* Tier = RenderTiers.Find(TierName);
+	if (!Tier)
+	{
+		Tier = s_GetBuiltInRenderTiers().Find(TierName);
+	}
+	if (!Tier)
+		return nullptr;
+
+	FResolvedRenderTier& Resolved = ResolvedRenderTiers.FindOrAdd(TierName);
+	if (Resolved.bValid && Resolved.TopologyGeneration == Topology.Generation)
+		return &Resolved;
+
+	Resolved.bValid = true;
+	Resolved.TopologyGeneration = Topology.Generation;
+	Resolved.Viewports.Reset();
+	for (int32 ViewportIdx = 0; ViewportIdx < Topology.ViewportNameStrings.Num(); ++ViewportIdx)
 	{
-		UDisplayClusterCameraComponent* DefaultViewPoint = Cast<UDisplayClusterCameraComponent>(DefaultViewPoint_Property->GetObjectPropertyValue_InContainer(s_DisplayClusterRoot.Get()));
-		if (DefaultViewPoint)
+		for (const FStageAPIRenderTierEntry& Entry : Tier->Entries)
 		{
-			return DefaultViewPoint->GetRelativeLocation();
-			//return DefaultViewPoint->GetRelativeTransform().GetLocation();
+			if (Topology.ViewportNameStrings[ViewportIdx].MatchesWildcard(Entry.ViewportPattern))
+			{
+				Resolved.Viewports.Emplace(ViewportIdx, Entry.Settings);
+				break;
+			}
 		}
 	}
-	return FVector();
+	return &Resolved;
 }
 
-void UStageAPIImpl::SetDefaultViewPosition(FVector NewPosition)
+bool UStageAPIImpl::ApplyRenderTier(FName TierName)
 {
-	API_CHECK_VOID
+	STAGEAPI_TRACE(ApplyRenderTier)
+	STAGEAPI_JOURNAL(ApplyRenderTier, TierName)
+	API_CHECK_BOOL
 
-	FObjectProperty* DefaultViewPoint_Property = CastField<FObjectProperty>(s_DisplayClusterRoot->GetClass()->FindPropertyByName("DefaultViewPoint"));
-	
-	if (DefaultViewPoint_Property)
+	const FStageTopology& Topology = s_GetStageTopology(s_DisplayClusterRoot.Get());
+	const FResolvedRenderTier* Resolved = ResolveRenderTier(TierName, Topology);
+	if (!Resolved)
 	{
-		UDisplayClusterCameraComponent* DefaultViewPoint = Cast<UDisplayClusterCameraComponent>(DefaultViewPoint_Property->GetObjectPropertyValue_InContainer(s_DisplayClusterRoot.Get()));
-		if (DefaultViewPoint)
-		{
-			GEngine->BeginTransaction(*FString(TEXT(TEXT_API_TAG)), FText::FromString(TEXT("Update Default View Location")), s_DisplayClusterRoot.Get());
-			DefaultViewPoint->Modify();
-			DefaultViewPoint->SetRelativeLocation(NewPosition);
-			//DefaultViewPoint->GetRelativeTransform().SetLocation(NewPosition);
-			GEngine->EndTransaction();
-		}
+		UE_LOG(StageAPIEditor, Warning, TEXT("VP Stage API render tier '%s' does not exist"), *TierName.ToString());
+		return false;
 	}
-}
 
+	s_BeginTransaction(TEXT("Apply Render Tier"), s_DisplayClusterRoot.Get());
+	for (const TPair<int32, FStageAPIViewportRenderSettings>& Viewport : Resolved->Viewports)
+	{
+		s_WriteViewportRenderSettings(Topology.ViewportObjects[Viewport.Key].Get(), Viewport.Value);
+	}
+	s_EndTransaction();
 
+	ActiveRenderTier = TierName;
+	return true;
+}
 
+FName UStageAPIImpl::GetActiveRenderTier() const
+{
+	STAGEAPI_TRACE(GetActiveRenderTier)
+	STAGEAPI_JOURNAL(GetActiveRenderTier)
+	return ActiveRenderTier;
+}
 
-#pragma endregion //END nDisplay API
+#pragma endregion
 
 
 
@@ -956,6 +3327,8 @@ void UStageAPIImpl::SetDefaultViewPosition(FVector NewPosition)
 
 float UStageAPIImpl::GetStageExposure() const
 {
+	STAGEAPI_TRACE(GetStageExposure)
+	STAGEAPI_JOURNAL(GetStageExposure)
 	API_CHECK_FLOAT
 
 	return s_DisplayClusterRoot->GetConfigData()->StageSettings.EntireClusterColorGrading.ColorGradingSettings.AutoExposureBias;
@@ -964,34 +3337,42 @@ float UStageAPIImpl::GetStageExposure() const
 
 void UStageAPIImpl::SetStageExposure(float ExposureCompensation)
 {
+	STAGEAPI_TRACE(SetStageExposure)
+	STAGEAPI_JOURNAL(SetStageExposure, ExposureCompensation)
 	API_CHECK_VOID
+	API_COALESCE(EStageAPIProperty::StageExposure, FVector4(ExposureCompensation, 0, 0, 0))
 
-	GEngine->BeginTransaction(*FString(TEXT(TEXT_API_TAG)), FText::FromString(TEXT("Update stage exposure")), s_DisplayClusterRoot.Get());
+	s_BeginTransaction(TEXT("Update stage exposure"), s_DisplayClusterRoot.Get());
 
 	s_DisplayClusterRoot->GetConfigData()->Modify();
 	s_DisplayClusterRoot->GetConfigData()->StageSettings.EntireClusterColorGrading.bEnableEntireClusterColorGrading = true;
 	s_DisplayClusterRoot->GetConfigData()->StageSettings.EntireClusterColorGrading.ColorGradingSettings.bOverride_AutoExposureBias = true;
 	s_DisplayClusterRoot->GetConfigData()->StageSettings.EntireClusterColorGrading.ColorGradingSettings.AutoExposureBias = ExposureCompensation;
 	
-	GEngine->EndTransaction();
+	s_EndTransaction();
 }
 
 void UStageAPIImpl::DisableStageExposure()
 {
+	STAGEAPI_TRACE(DisableStageExposure)
+	STAGEAPI_JOURNAL(DisableStageExposure)
 	API_CHECK_VOID
 
-	GEngine->BeginTransaction(*FString(TEXT(TEXT_API_TAG)), FText::FromString(TEXT("Update stage exposure")), s_DisplayClusterRoot.Get());
+	s_BeginTransaction(TEXT("Update stage exposure"), s_DisplayClusterRoot.Get());
 
 	s_DisplayClusterRoot->GetConfigData()->Modify();
 	s_DisplayClusterRoot->GetConfigData()->StageSettings.EntireClusterColorGrading.ColorGradingSettings.bOverride_AutoExposureBias = false;
 	
-	GEngine->EndTransaction();
+	s_EndTransaction();
 
 	
 }
 
 void UStageAPIImpl::SetChromakeyStatus(bool ChromakeyEnabled)
 {
+	STAGEAPI_TRACE(SetChromakeyStatus)
+	STAGEAPI_JOURNAL(SetChromakeyStatus, ChromakeyEnabled)
+	API_COALESCE(EStageAPIProperty::ChromakeyEnabled, FVector4(ChromakeyEnabled ? 1 : 0, 0, 0, 0))
 	if (ChromakeyEnabled)
 		EnableChromakey();
 	else
@@ -1000,39 +3381,45 @@ void UStageAPIImpl::SetChromakeyStatus(bool ChromakeyEnabled)
 
 void UStageAPIImpl::DisableChromakey()
 {
+	STAGEAPI_TRACE(DisableChromakey)
+	STAGEAPI_JOURNAL(DisableChromakey)
 	API_CHECK_VOID
 
 	auto IcVFXComponent = GetIcvfxCameraComponent();
 	if (!IcVFXComponent)
 		return;
 
-	GEngine->BeginTransaction(*FString(TEXT(TEXT_API_TAG)), FText::FromString(TEXT("Disable chromakey")), s_DisplayClusterRoot.Get());
+	s_BeginTransaction(TEXT("Disable chromakey"), s_DisplayClusterRoot.Get());
 	s_DisplayClusterRoot->Modify();
 	IcVFXComponent->Modify();
 	IcVFXComponent->CameraSettings.Chromakey.bEnable = false;
 
-	GEngine->EndTransaction();
+	s_EndTransaction();
 	
 }
 
 void UStageAPIImpl::EnableChromakey()
 {
+	STAGEAPI_TRACE(EnableChromakey)
+	STAGEAPI_JOURNAL(EnableChromakey)
 	API_CHECK_VOID
 	
 	auto IcVFXComponent = GetIcvfxCameraComponent();
 	if (!IcVFXComponent)
 		return;
 
-	GEngine->BeginTransaction(*FString(TEXT(TEXT_API_TAG)), FText::FromString(TEXT("Enable chromakey")), s_DisplayClusterRoot.Get());
+	s_BeginTransaction(TEXT("Enable chromakey"), s_DisplayClusterRoot.Get());
 	s_DisplayClusterRoot->Modify();
 	IcVFXComponent->Modify();
 	IcVFXComponent->CameraSettings.Chromakey.bEnable = true;
 
-	GEngine->EndTransaction();
+	s_EndTransaction();
 }
 
 bool UStageAPIImpl::GetChromakeyStatus() const
 {
+	STAGEAPI_TRACE(GetChromakeyStatus)
+	STAGEAPI_JOURNAL(GetChromakeyStatus)
 	API_CHECK_BOOL
 
 	auto IcVFXComponent = GetIcvfxCameraComponent();
@@ -1044,6 +3431,8 @@ bool UStageAPIImpl::GetChromakeyStatus() const
 
 FVector4 UStageAPIImpl::GetClusterPP_GlobalSaturation() const
 {
+	STAGEAPI_TRACE(GetClusterPP_GlobalSaturation)
+	STAGEAPI_JOURNAL(GetClusterPP_GlobalSaturation)
 	API_CHECK_VECTOR4
 	return s_DisplayClusterRoot->GetConfigData()->StageSettings.EntireClusterColorGrading.ColorGradingSettings.Global.Saturation;
 }
@@ -1052,9 +3441,12 @@ FVector4 UStageAPIImpl::GetClusterPP_GlobalSaturation() const
 
 void UStageAPIImpl::SetClusterPP_GlobalSaturation(FVector4 NewSaturation)
 {
+	STAGEAPI_TRACE(SetClusterPP_GlobalSaturation)
+	STAGEAPI_JOURNAL(SetClusterPP_GlobalSaturation, NewSaturation)
 	API_CHECK_VOID
+	API_COALESCE(EStageAPIProperty::ClusterGlobalSaturation, NewSaturation)
 
-	GEngine->BeginTransaction(*FString(TEXT(TEXT_API_TAG)), FText::FromString(TEXT("Update post process global saturation")), s_DisplayClusterRoot.Get());
+	s_BeginTransaction(TEXT("Update post process global saturation"), s_DisplayClusterRoot.Get());
 
 	s_DisplayClusterRoot->GetConfigData()->Modify();
 	if (NewSaturation.X == 0 && NewSaturation.Y == 0 && NewSaturation.Z == 0)
@@ -1069,20 +3461,25 @@ void UStageAPIImpl::SetClusterPP_GlobalSaturation(FVector4 NewSaturation)
 	
 	s_DisplayClusterRoot->GetConfigData()->StageSettings.EntireClusterColorGrading.ColorGradingSettings.Global.Saturation = NewSaturation;
 	
-	GEngine->EndTransaction();
+	s_EndTransaction();
 }
 
 FVector4 UStageAPIImpl::GetClusterPP_GlobalContrast() const
 {
+	STAGEAPI_TRACE(GetClusterPP_GlobalContrast)
+	STAGEAPI_JOURNAL(GetClusterPP_GlobalContrast)
 	API_CHECK_VECTOR4
 	return s_DisplayClusterRoot->GetConfigData()->StageSettings.EntireClusterColorGrading.ColorGradingSettings.Global.Contrast;
 }
 
 void UStageAPIImpl::SetClusterPP_GlobalContrast(FVector4 NewContrast)
 {
+	STAGEAPI_TRACE(SetClusterPP_GlobalContrast)
+	STAGEAPI_JOURNAL(SetClusterPP_GlobalContrast, NewContrast)
 	API_CHECK_VOID
+	API_COALESCE(EStageAPIProperty::ClusterGlobalContrast, NewContrast)
 
-	GEngine->BeginTransaction(*FString(TEXT(TEXT_API_TAG)), FText::FromString(TEXT("Update post process global saturation")), s_DisplayClusterRoot.Get());
+	s_BeginTransaction(TEXT("Update post process global saturation"), s_DisplayClusterRoot.Get());
 
 	s_DisplayClusterRoot->GetConfigData()->Modify();
 	if (NewContrast.X == 0 && NewContrast.Y == 0 && NewContrast.Z == 0)
@@ -1097,20 +3494,25 @@ void UStageAPIImpl::SetClusterPP_GlobalContrast(FVector4 NewContrast)
 	
 	s_DisplayClusterRoot->GetConfigData()->StageSettings.EntireClusterColorGrading.ColorGradingSettings.Global.Contrast = NewContrast;
 	
-	GEngine->EndTransaction();
+	s_EndTransaction();
 }
 
 FVector4 UStageAPIImpl::GetClusterPP_GlobalGamma() const
 {
+	STAGEAPI_TRACE(GetClusterPP_GlobalGamma)
+	STAGEAPI_JOURNAL(GetClusterPP_GlobalGamma)
 	API_CHECK_VECTOR4
 	return s_DisplayClusterRoot->GetConfigData()->StageSettings.EntireClusterColorGrading.ColorGradingSettings.Global.Gamma;
 }
 
 void UStageAPIImpl::SetClusterPP_GlobalGamma(FVector4 NewGamma)
 {
+	STAGEAPI_TRACE(SetClusterPP_GlobalGamma)
+	STAGEAPI_JOURNAL(SetClusterPP_GlobalGamma, NewGamma)
 	API_CHECK_VOID
+	API_COALESCE(EStageAPIProperty::ClusterGlobalGamma, NewGamma)
 
-	GEngine->BeginTransaction(*FString(TEXT(TEXT_API_TAG)), FText::FromString(TEXT("Update post process global saturation")), s_DisplayClusterRoot.Get());
+	s_BeginTransaction(TEXT("Update post process global saturation"), s_DisplayClusterRoot.Get());
 
 	s_DisplayClusterRoot->GetConfigData()->Modify();
 	if (NewGamma.X == 0 && NewGamma.Y == 0 && NewGamma.Z == 0)
@@ -1125,20 +3527,25 @@ void UStageAPIImpl::SetClusterPP_GlobalGamma(FVector4 NewGamma)
 	
 	s_DisplayClusterRoot->GetConfigData()->StageSettings.EntireClusterColorGrading.ColorGradingSettings.Global.Gamma = NewGamma;
 	
-	GEngine->EndTransaction();
+	s_EndTransaction();
 }
 
 FVector4 UStageAPIImpl::GetClusterPP_GlobalGain() const
 {
+	STAGEAPI_TRACE(GetClusterPP_GlobalGain)
+	STAGEAPI_JOURNAL(GetClusterPP_GlobalGain)
 	API_CHECK_VECTOR4
 	return s_DisplayClusterRoot->GetConfigData()->StageSettings.EntireClusterColorGrading.ColorGradingSettings.Global.Gain;
 }
 
 void UStageAPIImpl::SetClusterPP_GlobalGain(FVector4 NewGain)
 {
+	STAGEAPI_TRACE(SetClusterPP_GlobalGain)
+	STAGEAPI_JOURNAL(SetClusterPP_GlobalGain, NewGain)
 	API_CHECK_VOID
+	API_COALESCE(EStageAPIProperty::ClusterGlobalGain, NewGain)
 
-	GEngine->BeginTransaction(*FString(TEXT(TEXT_API_TAG)), FText::FromString(TEXT("Update post process global saturation")), s_DisplayClusterRoot.Get());
+	s_BeginTransaction(TEXT("Update post process global saturation"), s_DisplayClusterRoot.Get());
 
 	s_DisplayClusterRoot->GetConfigData()->Modify();
 	if (NewGain.X == 0 && NewGain.Y == 0 && NewGain.Z == 0)
@@ -1153,20 +3560,25 @@ void UStageAPIImpl::SetClusterPP_GlobalGain(FVector4 NewGain)
 	
 	s_DisplayClusterRoot->GetConfigData()->StageSettings.EntireClusterColorGrading.ColorGradingSettings.Global.Gain = NewGain;
 	
-	GEngine->EndTransaction();
+	s_EndTransaction();
 }
 
 FVector4 UStageAPIImpl::GetClusterPP_GlobalOffset() const
 {
+	STAGEAPI_TRACE(GetClusterPP_GlobalOffset)
+	STAGEAPI_JOURNAL(GetClusterPP_GlobalOffset)
 	API_CHECK_VECTOR4
 	return s_DisplayClusterRoot->GetConfigData()->StageSettings.EntireClusterColorGrading.ColorGradingSettings.Global.Offset;
 }
 
 void UStageAPIImpl::SetClusterPP_GlobalOffset(FVector4 NewOffset)
 {
+	STAGEAPI_TRACE(SetClusterPP_GlobalOffset)
+	STAGEAPI_JOURNAL(SetClusterPP_GlobalOffset, NewOffset)
 	API_CHECK_VOID
+	API_COALESCE(EStageAPIProperty::ClusterGlobalOffset, NewOffset)
 
-	GEngine->BeginTransaction(*FString(TEXT(TEXT_API_TAG)), FText::FromString(TEXT("Update post process global saturation")), s_DisplayClusterRoot.Get());
+	s_BeginTransaction(TEXT("Update post process global saturation"), s_DisplayClusterRoot.Get());
 
 	s_DisplayClusterRoot->GetConfigData()->Modify();
 	if (NewOffset.X == 0 && NewOffset.Y == 0 && NewOffset.Z == 0)
@@ -1181,11 +3593,13 @@ void UStageAPIImpl::SetClusterPP_GlobalOffset(FVector4 NewOffset)
 	
 	s_DisplayClusterRoot->GetConfigData()->StageSettings.EntireClusterColorGrading.ColorGradingSettings.Global.Offset = NewOffset;
 	
-	GEngine->EndTransaction();
+	s_EndTransaction();
 }
 
 FVector4 UStageAPIImpl::GetClusterPP_ShadowsGain() const
 {
+	STAGEAPI_TRACE(GetClusterPP_ShadowsGain)
+	STAGEAPI_JOURNAL(GetClusterPP_ShadowsGain)
 	API_CHECK_VECTOR4
 	return s_DisplayClusterRoot->GetConfigData()->StageSettings.EntireClusterColorGrading.ColorGradingSettings.Shadows.Gain;
 }
@@ -1193,9 +3607,12 @@ FVector4 UStageAPIImpl::GetClusterPP_ShadowsGain() const
 
 void UStageAPIImpl::SetClusterPP_ShadowsGain(FVector4 NewShadowsGain)
 {
+	STAGEAPI_TRACE(SetClusterPP_ShadowsGain)
+	STAGEAPI_JOURNAL(SetClusterPP_ShadowsGain, NewShadowsGain)
 	API_CHECK_VOID
+	API_COALESCE(EStageAPIProperty::ClusterShadowsGain, NewShadowsGain)
 
-	GEngine->BeginTransaction(*FString(TEXT(TEXT_API_TAG)), FText::FromString(TEXT("Update post process global saturation")), s_DisplayClusterRoot.Get());
+	s_BeginTransaction(TEXT("Update post process global saturation"), s_DisplayClusterRoot.Get());
 
 	s_DisplayClusterRoot->GetConfigData()->Modify();
 	if (NewShadowsGain.X == 0 && NewShadowsGain.Y == 0 && NewShadowsGain.Z == 0)
@@ -1210,20 +3627,25 @@ void UStageAPIImpl::SetClusterPP_ShadowsGain(FVector4 NewShadowsGain)
 	
 	s_DisplayClusterRoot->GetConfigData()->StageSettings.EntireClusterColorGrading.ColorGradingSettings.Shadows.Gain = NewShadowsGain;
 	
-	GEngine->EndTransaction();
+	s_EndTransaction();
 }
 
 FVector4 UStageAPIImpl::GetClusterPP_MidsGain() const
 {
+	STAGEAPI_TRACE(GetClusterPP_MidsGain)
+	STAGEAPI_JOURNAL(GetClusterPP_MidsGain)
 	API_CHECK_VECTOR4
 	return s_DisplayClusterRoot->GetConfigData()->StageSettings.EntireClusterColorGrading.ColorGradingSettings.Midtones.Gain;
 }
 
 void UStageAPIImpl::SetClusterPP_MidsGain(FVector4 NewMidsGain)
 {
+	STAGEAPI_TRACE(SetClusterPP_MidsGain)
+	STAGEAPI_JOURNAL(SetClusterPP_MidsGain, NewMidsGain)
 	API_CHECK_VOID
+	API_COALESCE(EStageAPIProperty::ClusterMidsGain, NewMidsGain)
 
-	GEngine->BeginTransaction(*FString(TEXT(TEXT_API_TAG)), FText::FromString(TEXT("Update post process global saturation")), s_DisplayClusterRoot.Get());
+	s_BeginTransaction(TEXT("Update post process global saturation"), s_DisplayClusterRoot.Get());
 
 	s_DisplayClusterRoot->GetConfigData()->Modify();
 	if (NewMidsGain.X == 0 && NewMidsGain.Y == 0 && NewMidsGain.Z == 0)
@@ -1238,20 +3660,25 @@ void UStageAPIImpl::SetClusterPP_MidsGain(FVector4 NewMidsGain)
 	
 	s_DisplayClusterRoot->GetConfigData()->StageSettings.EntireClusterColorGrading.ColorGradingSettings.Midtones.Gain = NewMidsGain;
 	
-	GEngine->EndTransaction();
+	s_EndTransaction();
 }
 
 FVector4 UStageAPIImpl::GetClusterPP_HighlightsGain() const
 {
+	STAGEAPI_TRACE(GetClusterPP_HighlightsGain)
+	STAGEAPI_JOURNAL(GetClusterPP_HighlightsGain)
 	API_CHECK_VECTOR4
 	return s_DisplayClusterRoot->GetConfigData()->StageSettings.EntireClusterColorGrading.ColorGradingSettings.Highlights.Gain;
 }
 
 void UStageAPIImpl::SetClusterPP_HighlightsGain(FVector4 NewHighlightsGain)
 {
+	STAGEAPI_TRACE(SetClusterPP_HighlightsGain)
+	STAGEAPI_JOURNAL(SetClusterPP_HighlightsGain, NewHighlightsGain)
 	API_CHECK_VOID
+	API_COALESCE(EStageAPIProperty::ClusterHighlightsGain, NewHighlightsGain)
 
-	GEngine->BeginTransaction(*FString(TEXT(TEXT_API_TAG)), FText::FromString(TEXT("Update post process global saturation")), s_DisplayClusterRoot.Get());
+	s_BeginTransaction(TEXT("Update post process global saturation"), s_DisplayClusterRoot.Get());
 
 	s_DisplayClusterRoot->GetConfigData()->Modify();
 	if (NewHighlightsGain.X == 0 && NewHighlightsGain.Y == 0 && NewHighlightsGain.Z == 0)
@@ -1266,13 +3693,236 @@ void UStageAPIImpl::SetClusterPP_HighlightsGain(FVector4 NewHighlightsGain)
 	
 	s_DisplayClusterRoot->GetConfigData()->StageSettings.EntireClusterColorGrading.ColorGradingSettings.Highlights.Gain = NewHighlightsGain;
 	
-	GEngine->EndTransaction();
+	s_EndTransaction();
+}
+
+//FRUSTUM GRADE FUNCTIONS
+
+FVector4 UStageAPIImpl::GetFrustumPP_GlobalSaturation() const
+{
+	STAGEAPI_TRACE(GetFrustumPP_GlobalSaturation)
+	STAGEAPI_JOURNAL(GetFrustumPP_GlobalSaturation)
+	API_CHECK_VECTOR4
+	
+	auto const IcvfxComponent = GetIcvfxCameraComponentA();
+
+	if (!IcvfxComponent)
+		return FVector4();
+
+	return IcvfxComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.Global.Saturation;
+}
+
+void UStageAPIImpl::SetFrustumPP_GlobalSaturation(FVector4 NewSaturation)
+{
+	STAGEAPI_TRACE(SetFrustumPP_GlobalSaturation)
+	STAGEAPI_JOURNAL(SetFrustumPP_GlobalSaturation, NewSaturation)
+	API_CHECK_VOID
+	API_COALESCE(EStageAPIProperty::FrustumGlobalSaturation, NewSaturation)
+	
+	auto const IcvfxComponent = GetIcvfxCameraComponentA();
+
+	if (!IcvfxComponent)
+		return;
+
+	s_BeginTransaction(TEXT("Update ICVFX Color Grade"), s_DisplayClusterRoot.Get());
+	IcvfxComponent->Modify();
+
+	if (NewSaturation.X == 0 && NewSaturation.Y == 0 && NewSaturation.Z == 0)
+	{
+		IcvfxComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.Global.bOverride_Saturation = false;
+	}
+	else
+	{
+		IcvfxComponent->CameraSettings.AllNodesColorGrading.bEnableEntireClusterColorGrading = true;
+		IcvfxComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.Global.bOverride_Saturation = true;
+		
+	}
+	IcvfxComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.Global.Saturation = NewSaturation;
+
+	s_EndTransaction();
+}
+
+
+FVector4 UStageAPIImpl::GetFrustumPP_GlobalContrast() const
+{
+	STAGEAPI_TRACE(GetFrustumPP_GlobalContrast)
+	STAGEAPI_JOURNAL(GetFrustumPP_GlobalContrast)
+	API_CHECK_VECTOR4
+	
+	auto const IcvfxComponent = GetIcvfxCameraComponentA();
+
+	if (!IcvfxComponent)
+		return FVector4();
+
+	return IcvfxComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.Global.Contrast;
+}
+
+void UStageAPIImpl::SetFrustumPP_GlobalContrast(FVector4 NewContrast)
+{
+	STAGEAPI_TRACE(SetFrustumPP_GlobalContrast)
+	STAGEAPI_JOURNAL(SetFrustumPP_GlobalContrast, NewContrast)
+	API_CHECK_VOID
+	API_COALESCE(EStageAPIProperty::FrustumGlobalContrast, NewContrast)
+	
+	auto const IcvfxComponent = GetIcvfxCameraComponentA();
+
+	if (!IcvfxComponent)
+		return;
+
+	s_BeginTransaction(TEXT("Update ICVFX Color Grade"), s_DisplayClusterRoot.Get());
+	IcvfxComponent->Modify();
+
+	if (NewContrast.X == 0 && NewContrast.Y == 0 && NewContrast.Z == 0)
+	{
+		IcvfxComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.Global.bOverride_Contrast = false;
+	}
+	else
+	{
+		IcvfxComponent->CameraSettings.AllNodesColorGrading.bEnableEntireClusterColorGrading = true;
+		IcvfxComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.Global.bOverride_Contrast = true;
+		
+	}
+	IcvfxComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.Global.Contrast = NewContrast;
+
+	s_EndTransaction();
+}
+
+FVector4 UStageAPIImpl::GetFrustumPP_GlobalGamma() const
+{
+	STAGEAPI_TRACE(GetFrustumPP_GlobalGamma)
+	STAGEAPI_JOURNAL(GetFrustumPP_GlobalGamma)
+	API_CHECK_VECTOR4
+	
+	auto const IcvfxComponent = GetIcvfxCameraComponentA();
+
+	if (!IcvfxComponent)
+		return FVector4();
+
+	return IcvfxComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.Global.Gamma;
+}
+
+void UStageAPIImpl::SetFrustumPP_GlobalGamma(FVector4 NewGamma)
+{
+	STAGEAPI_TRACE(SetFrustumPP_GlobalGamma)
+	STAGEAPI_JOURNAL(SetFrustumPP_GlobalGamma, NewGamma)
+	API_CHECK_VOID
+	API_COALESCE(EStageAPIProperty::FrustumGlobalGamma, NewGamma)
+	
+	auto const IcvfxComponent = GetIcvfxCameraComponentA();
+
+	if (!IcvfxComponent)
+		return;
+
+	s_BeginTransaction(TEXT("Update ICVFX Color Grade"), s_DisplayClusterRoot.Get());
+	IcvfxComponent->Modify();
+
+	if (NewGamma.X == 0 && NewGamma.Y == 0 && NewGamma.Z == 0)
+	{
+		IcvfxComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.Global.bOverride_Gain = false;
+	}
+	else
+	{
+		IcvfxComponent->CameraSettings.AllNodesColorGrading.bEnableEntireClusterColorGrading = true;
+		IcvfxComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.Global.bOverride_Gain = true;
+		
+	}
+	IcvfxComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.Global.Gamma = NewGamma;
+
+	s_EndTransaction();
+}
+
+FVector4 UStageAPIImpl::GetFrustumPP_GlobalGain() const
+{
+	STAGEAPI_TRACE(GetFrustumPP_GlobalGain)
+	STAGEAPI_JOURNAL(GetFrustumPP_GlobalGain)
+	API_CHECK_VECTOR4
+	
+	auto const IcvfxComponent = GetIcvfxCameraComponentA();
+
+	if (!IcvfxComponent)
+		return FVector4();
+
+	return IcvfxComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.Global.Gain;
+}
+
+void UStageAPIImpl::SetFrustumPP_GlobalGain(FVector4 NewGain)
+{
+	STAGEAPI_TRACE(SetFrustumPP_GlobalGain)
+	STAGEAPI_JOURNAL(SetFrustumPP_GlobalGain, NewGain)
+	API_CHECK_VOID
+	API_COALESCE(EStageAPIProperty::FrustumGlobalGain, NewGain)
+	
+	auto const IcvfxComponent = GetIcvfxCameraComponentA();
+
+	if (!IcvfxComponent)
+		return;
+
+	s_BeginTransaction(TEXT("Update ICVFX Color Grade"), s_DisplayClusterRoot.Get());
+	IcvfxComponent->Modify();
+
+	if (NewGain.X == 0 && NewGain.Y == 0 && NewGain.Z == 0)
+	{
+		IcvfxComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.Global.bOverride_Gain = false;
+	}
+	else
+	{
+		IcvfxComponent->CameraSettings.AllNodesColorGrading.bEnableEntireClusterColorGrading = true;
+		IcvfxComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.Global.bOverride_Gain = true;
+		
+	}
+	IcvfxComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.Global.Gain = NewGain;
+
+	s_EndTransaction();
+}
+
+FVector4 UStageAPIImpl::GetFrustumPP_GlobalOffset() const
+{
+	STAGEAPI_TRACE(GetFrustumPP_GlobalOffset)
+	STAGEAPI_JOURNAL(GetFrustumPP_GlobalOffset)
+	API_CHECK_VECTOR4
+	
+	auto const IcvfxComponent = GetIcvfxCameraComponentA();
+
+	if (!IcvfxComponent)
+		return FVector4();
+
+	return IcvfxComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.Global.Offset;
 }
 
-//FRUSTUM GRADE FUNCTIONS
+void UStageAPIImpl::SetFrustumPP_GlobalOffset(FVector4 NewOffset)
+{
+	STAGEAPI_TRACE(SetFrustumPP_GlobalOffset)
+	STAGEAPI_JOURNAL(SetFrustumPP_GlobalOffset, NewOffset)
+	API_CHECK_VOID
+	API_COALESCE(EStageAPIProperty::FrustumGlobalOffset, NewOffset)
+	
+	auto const IcvfxComponent = GetIcvfxCameraComponentA();
+
+	if (!IcvfxComponent)
+		return;
+
+	s_BeginTransaction(TEXT("Update ICVFX Color Grade"), s_DisplayClusterRoot.Get());
+	IcvfxComponent->Modify();
+
+	if (NewOffset.X == 0 && NewOffset.Y == 0 && NewOffset.Z == 0)
+	{
+		IcvfxComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.Global.bOverride_Offset = false;
+	}
+	else
+	{
+		IcvfxComponent->CameraSettings.AllNodesColorGrading.bEnableEntireClusterColorGrading = true;
+		IcvfxComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.Global.bOverride_Offset = true;
+		
+	}
+	IcvfxComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.Global.Offset = NewOffset;
+
+	s_EndTransaction();
+}
 
-FVector4 UStageAPIImpl::GetFrustumPP_GlobalSaturation() const
+FVector4 UStageAPIImpl::GetFrustumPP_ShadowsGain() const
 {
+	STAGEAPI_TRACE(GetFrustumPP_ShadowsGain)
+	STAGEAPI_JOURNAL(GetFrustumPP_ShadowsGain)
 	API_CHECK_VECTOR4
 	
 	auto const IcvfxComponent = GetIcvfxCameraComponentA();
@@ -1280,39 +3930,43 @@ FVector4 UStageAPIImpl::GetFrustumPP_GlobalSaturation() const
 	if (!IcvfxComponent)
 		return FVector4();
 
-	return IcvfxComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.Global.Saturation;
+	return IcvfxComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.Shadows.Gain;
 }
 
-void UStageAPIImpl::SetFrustumPP_GlobalSaturation(FVector4 NewSaturation)
+void UStageAPIImpl::SetFrustumPP_ShadowsGain(FVector4 NewShadowsGain)
 {
+	STAGEAPI_TRACE(SetFrustumPP_ShadowsGain)
+	STAGEAPI_JOURNAL(SetFrustumPP_ShadowsGain, NewShadowsGain)
 	API_CHECK_VOID
+	API_COALESCE(EStageAPIProperty::FrustumShadowsGain, NewShadowsGain)
 	
 	auto const IcvfxComponent = GetIcvfxCameraComponentA();
 
 	if (!IcvfxComponent)
 		return;
 
-	GEngine->BeginTransaction(*FString(TEXT(TEXT_API_TAG)), FText::FromString(TEXT("Update ICVFX Color Grade")), s_DisplayClusterRoot.Get());
+	s_BeginTransaction(TEXT("Update ICVFX Color Grade"), s_DisplayClusterRoot.Get());
 	IcvfxComponent->Modify();
 
-	if (NewSaturation.X == 0 && NewSaturation.Y == 0 && NewSaturation.Z == 0)
+	if (NewShadowsGain.X == 0 && NewShadowsGain.Y == 0 && NewShadowsGain.Z == 0)
 	{
-		IcvfxComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.Global.bOverride_Saturation = false;
+		IcvfxComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.Shadows.bOverride_Gain = false;
 	}
 	else
 	{
 		IcvfxComponent->CameraSettings.AllNodesColorGrading.bEnableEntireClusterColorGrading = true;
-		IcvfxComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.Global.bOverride_Saturation = true;
+		IcvfxComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.Shadows.bOverride_Gain = true;
 		
 	}
-	IcvfxComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.Global.Saturation = NewSaturation;
+	IcvfxComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.Shadows.Gain = NewShadowsGain;
 
-	GEngine->EndTransaction();
+	s_EndTransaction();
 }
 
-
-FVector4 UStageAPIImpl::GetFrustumPP_GlobalContrast() const
+FVector4 UStageAPIImpl::GetFrustumPP_MidsGain() const
 {
+	STAGEAPI_TRACE(GetFrustumPP_MidsGain)
+	STAGEAPI_JOURNAL(GetFrustumPP_MidsGain)
 	API_CHECK_VECTOR4
 	
 	auto const IcvfxComponent = GetIcvfxCameraComponentA();
@@ -1320,38 +3974,43 @@ FVector4 UStageAPIImpl::GetFrustumPP_GlobalContrast() const
 	if (!IcvfxComponent)
 		return FVector4();
 
-	return IcvfxComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.Global.Contrast;
+	return IcvfxComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.Midtones.Gain;
 }
 
-void UStageAPIImpl::SetFrustumPP_GlobalContrast(FVector4 NewContrast)
+void UStageAPIImpl::SetFrustumPP_MidsGain(FVector4 NewMidsGain)
 {
+	STAGEAPI_TRACE(SetFrustumPP_MidsGain)
+	STAGEAPI_JOURNAL(SetFrustumPP_MidsGain, NewMidsGain)
 	API_CHECK_VOID
+	API_COALESCE(EStageAPIProperty::FrustumMidsGain, NewMidsGain)
 	
 	auto const IcvfxComponent = GetIcvfxCameraComponentA();
 
 	if (!IcvfxComponent)
 		return;
 
-	GEngine->BeginTransaction(*FString(TEXT(TEXT_API_TAG)), FText::FromString(TEXT("Update ICVFX Color Grade")), s_DisplayClusterRoot.Get());
+	s_BeginTransaction(TEXT("Update ICVFX Color Grade"), s_DisplayClusterRoot.Get());
 	IcvfxComponent->Modify();
 
-	if (NewContrast.X == 0 && NewContrast.Y == 0 && NewContrast.Z == 0)
+	if (NewMidsGain.X == 0 && NewMidsGain.Y == 0 && NewMidsGain.Z == 0)
 	{
-		IcvfxComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.Global.bOverride_Contrast = false;
+		IcvfxComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.Midtones.bOverride_Gain = false;
 	}
 	else
 	{
 		IcvfxComponent->CameraSettings.AllNodesColorGrading.bEnableEntireClusterColorGrading = true;
-		IcvfxComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.Global.bOverride_Contrast = true;
+		IcvfxComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.Midtones.bOverride_Gain = true;
 		
 	}
-	IcvfxComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.Global.Contrast = NewContrast;
+	IcvfxComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.Midtones.Gain = NewMidsGain;
 
-	GEngine->EndTransaction();
+	s_EndTransaction();
 }
 
-FVector4 UStageAPIImpl::GetFrustumPP_GlobalGamma() const
+FVector4 UStageAPIImpl::GetFrustumPP_HighlightsGain() const
 {
+	STAGEAPI_TRACE(GetFrustumPP_HighlightsGain)
+	STAGEAPI_JOURNAL(GetFrustumPP_HighlightsGain)
 	API_CHECK_VECTOR4
 	
 	auto const IcvfxComponent = GetIcvfxCameraComponentA();
@@ -1359,256 +4018,843 @@ FVector4 UStageAPIImpl::GetFrustumPP_GlobalGamma() const
 	if (!IcvfxComponent)
 		return FVector4();
 
-	return IcvfxComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.Global.Gamma;
+	return IcvfxComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.Highlights.Gain;
 }
 
-void UStageAPIImpl::SetFrustumPP_GlobalGamma(FVector4 NewGamma)
+void UStageAPIImpl::SetFrustumPP_HighlightsGain(FVector4 NewHighlightsGain)
 {
+	STAGEAPI_TRACE(SetFrustumPP_HighlightsGain)
+	STAGEAPI_JOURNAL(SetFrustumPP_HighlightsGain, NewHighlightsGain)
 	API_CHECK_VOID
+	API_COALESCE(EStageAPIProperty::FrustumHighlightsGain, NewHighlightsGain)
 	
 	auto const IcvfxComponent = GetIcvfxCameraComponentA();
 
 	if (!IcvfxComponent)
 		return;
 
-	GEngine->BeginTransaction(*FString(TEXT(TEXT_API_TAG)), FText::FromString(TEXT("Update ICVFX Color Grade")), s_DisplayClusterRoot.Get());
+	s_BeginTransaction(TEXT("Update ICVFX Color Grade"), s_DisplayClusterRoot.Get());
 	IcvfxComponent->Modify();
 
-	if (NewGamma.X == 0 && NewGamma.Y == 0 && NewGamma.Z == 0)
+	if (NewHighlightsGain.X == 0 && NewHighlightsGain.Y == 0 && NewHighlightsGain.Z == 0)
 	{
-		IcvfxComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.Global.bOverride_Gain = false;
+		IcvfxComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.Highlights.bOverride_Gain = false;
 	}
 	else
 	{
 		IcvfxComponent->CameraSettings.AllNodesColorGrading.bEnableEntireClusterColorGrading = true;
-		IcvfxComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.Global.bOverride_Gain = true;
+		IcvfxComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.Highlights.bOverride_Gain = true;
 		
 	}
-	IcvfxComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.Global.Gamma = NewGamma;
+	IcvfxComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.Highlights.Gain = NewHighlightsGain;
 
-	GEngine->EndTransaction();
+	s_EndTransaction();
 }
 
-FVector4 UStageAPIImpl::GetFrustumPP_GlobalGain() const
+//WHOLE GRADE FUNCTIONS
+
+/**
+ * @brief Copies the Global/Shadows/Midtones/Highlights bands between the nDisplay color grading settings (cluster or
+ * ICVFX) and the API struct. Templated so the same copy serves both nDisplay band types.
+ */
+template<typename TGradingBand>
+static void s_ReadColorGradingBand(const TGradingBand& Band, FStageAPIColorGradingBand& OutBand)
 {
-	API_CHECK_VECTOR4
-	
+	OutBand.bOverride_Saturation = Band.bOverride_Saturation;
+	OutBand.Saturation = Band.Saturation;
+	OutBand.bOverride_Contrast = Band.bOverride_Contrast;
+	OutBand.Contrast = Band.Contrast;
+	OutBand.bOverride_Gamma = Band.bOverride_Gamma;
+	OutBand.Gamma = Band.Gamma;
+	OutBand.bOverride_Gain = Band.bOverride_Gain;
+	OutBand.Gain = Band.Gain;
+	OutBand.bOverride_Offset = Band.bOverride_Offset;
+	OutBand.Offset = Band.Offset;
+}
+
+template<typename TGradingBand>
+static void s_WriteColorGradingBand(const FStageAPIColorGradingBand& Band, TGradingBand& OutBand)
+{
+	OutBand.bOverride_Saturation = Band.bOverride_Saturation;
+	OutBand.Saturation = Band.Saturation;
+	OutBand.bOverride_Contrast = Band.bOverride_Contrast;
+	OutBand.Contrast = Band.Contrast;
+	OutBand.bOverride_Gamma = Band.bOverride_Gamma;
+	OutBand.Gamma = Band.Gamma;
+	OutBand.bOverride_Gain = Band.bOverride_Gain;
+	OutBand.Gain = Band.Gain;
+	OutBand.bOverride_Offset = Band.bOverride_Offset;
+	OutBand.Offset = Band.Offset;
+}
+
+template<typename TGradingSettings>
+static FStageAPIColorGrading s_ReadColorGrading(const TGradingSettings& Settings, bool bEnableColorGrading)
+{
+	FStageAPIColorGrading ColorGrading;
+	ColorGrading.bEnableColorGrading = bEnableColorGrading;
+	s_ReadColorGradingBand(Settings.Global, ColorGrading.Global);
+	s_ReadColorGradingBand(Settings.Shadows, ColorGrading.Shadows);
+	s_ReadColorGradingBand(Settings.Midtones, ColorGrading.Midtones);
+	s_ReadColorGradingBand(Settings.Highlights, ColorGrading.Highlights);
+	return ColorGrading;
+}
+
+template<typename TGradingSettings>
+static void s_WriteColorGrading(const FStageAPIColorGrading& ColorGrading, TGradingSettings& OutSettings)
+{
+	s_WriteColorGradingBand(ColorGrading.Global, OutSettings.Global);
+	s_WriteColorGradingBand(ColorGrading.Shadows, OutSettings.Shadows);
+	s_WriteColorGradingBand(ColorGrading.Midtones, OutSettings.Midtones);
+	s_WriteColorGradingBand(ColorGrading.Highlights, OutSettings.Highlights);
+}
+
+FStageAPIColorGrading UStageAPIImpl::GetClusterColorGrading() const
+{
+	STAGEAPI_TRACE(GetClusterColorGrading)
+	STAGEAPI_JOURNAL(GetClusterColorGrading)
+	API_CHECK_COLORGRADING
+
+	auto const& ClusterColorGrading = s_DisplayClusterRoot->GetConfigData()->StageSettings.EntireClusterColorGrading;
+	return s_ReadColorGrading(ClusterColorGrading.ColorGradingSettings, ClusterColorGrading.bEnableEntireClusterColorGrading);
+}
+
+void UStageAPIImpl::SetClusterColorGrading(const FStageAPIColorGrading& NewColorGrading)
+{
+	STAGEAPI_TRACE(SetClusterColorGrading)
+	STAGEAPI_JOURNAL(SetClusterColorGrading, NewColorGrading)
+	API_CHECK_VOID
+
+	s_BeginTransaction(TEXT("Update cluster color grade"), s_DisplayClusterRoot.Get());
+
+	s_DisplayClusterRoot->GetConfigData()->Modify();
+	auto& ClusterColorGrading = s_DisplayClusterRoot->GetConfigData()->StageSettings.EntireClusterColorGrading;
+	ClusterColorGrading.bEnableEntireClusterColorGrading = NewColorGrading.bEnableColorGrading;
+	s_WriteColorGrading(NewColorGrading, ClusterColorGrading.ColorGradingSettings);
+
+	s_EndTransaction();
+}
+
+FStageAPIColorGrading UStageAPIImpl::GetFrustumColorGrading() const
+{
+	STAGEAPI_TRACE(GetFrustumColorGrading)
+	STAGEAPI_JOURNAL(GetFrustumColorGrading)
+	API_CHECK_COLORGRADING
+
 	auto const IcvfxComponent = GetIcvfxCameraComponentA();
 
 	if (!IcvfxComponent)
-		return FVector4();
+		return FStageAPIColorGrading();
 
-	return IcvfxComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.Global.Gain;
+	auto const& FrustumColorGrading = IcvfxComponent->CameraSettings.AllNodesColorGrading;
+	return s_ReadColorGrading(FrustumColorGrading.ColorGradingSettings, FrustumColorGrading.bEnableEntireClusterColorGrading);
 }
 
-void UStageAPIImpl::SetFrustumPP_GlobalGain(FVector4 NewGain)
+void UStageAPIImpl::SetFrustumColorGrading(const FStageAPIColorGrading& NewColorGrading)
 {
+	STAGEAPI_TRACE(SetFrustumColorGrading)
+	STAGEAPI_JOURNAL(SetFrustumColorGrading, NewColorGrading)
 	API_CHECK_VOID
-	
+
 	auto const IcvfxComponent = GetIcvfxCameraComponentA();
 
-	if (!IcvfxComponent)
-		return;
+	if (!IcvfxComponent)
+		return;
+
+	s_BeginTransaction(TEXT("Update ICVFX Color Grade"), s_DisplayClusterRoot.Get());
+
+	IcvfxComponent->Modify();
+	auto& FrustumColorGrading = IcvfxComponent->CameraSettings.AllNodesColorGrading;
+	FrustumColorGrading.bEnableEntireClusterColorGrading = NewColorGrading.bEnableColorGrading;
+	s_WriteColorGrading(NewColorGrading, FrustumColorGrading.ColorGradingSettings);
+
+	s_EndTransaction();
+}
+
+
+
+#pragma  endregion
+
+
+#pragma region "Presets"
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+// Stage Presets
+//
+//File layout (little endian): magic, version, preset count, then per preset its name, a property bitmask,
+//one FVector4f per set bit in enum order, both grades, the viewport render settings and (version 2) the override
+//flags of the cluster and both cameras. Properties are keyed by their EStageAPIProperty value, so presets only
+//survive new properties as long as they are appended to the end of the enum.
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+static constexpr uint32 StagePresetFileMagic = 0x50535056; //"VPSP"
+static constexpr uint32 StagePresetFileVersion = 2;
+static constexpr float StagePresetTolerance = 1.e-4f;
+
+static_assert(static_cast<uint8>(EStageAPIProperty::Count) <= 64, "Stage preset property mask is a uint64");
+
+//Smallest serialized entries (empty strings), used to reject counts a corrupt file could not possibly hold
+static constexpr int64 StagePresetMinViewportSize = sizeof(int32) + 2 * sizeof(float);
+static constexpr int64 StagePresetMinPresetSize = sizeof(int32) + sizeof(uint64) + sizeof(int32);
+
+//FString serialization allocates whatever length the file claims, so the length is checked against the bytes left first
+static void s_SerializePresetString(FArchive& Ar, FString& String)
+{
+	if (Ar.IsLoading())
+	{
+		int64 const LengthOffset = Ar.Tell();
+		int32 Length = 0;
+		Ar << Length;
+
+		//Negative lengths are UTF-16
+		int64 const NumBytes = Length < 0 ? -static_cast<int64>(Length) * static_cast<int64>(sizeof(UTF16CHAR)) : static_cast<int64>(Length);
+		if (Ar.IsError() || NumBytes > Ar.TotalSize() - Ar.Tell())
+		{
+			Ar.SetError();
+			return;
+		}
+		Ar.Seek(LengthOffset);
+	}
+	Ar << String;
+}
+
+static void s_SerializeOverrideFlags(FArchive& Ar, UStageAPIImpl::FGradingOverrideFlags& Flags)
+{
+	Ar << Flags.bEnableGrading << Flags.bEnableInnerFrustumGrading << Flags.bExposureOverride << Flags.BandOverrides;
+}
+
+static void s_SerializeColorGradingBand(FArchive& Ar, FStageAPIColorGradingBand& Band)
+{
+	auto SerializeField = [&Ar](bool& bOverride, FVector4& Value)
+	{
+		FVector4f StoredValue(Value);
+		Ar << bOverride << StoredValue;
+		Value = FVector4(StoredValue);
+	};
+
+	SerializeField(Band.bOverride_Saturation, Band.Saturation);
+	SerializeField(Band.bOverride_Contrast, Band.Contrast);
+	SerializeField(Band.bOverride_Gamma, Band.Gamma);
+	SerializeField(Band.bOverride_Gain, Band.Gain);
+	SerializeField(Band.bOverride_Offset, Band.Offset);
+}
+
+static void s_SerializeColorGrading(FArchive& Ar, FStageAPIColorGrading& ColorGrading)
+{
+	Ar << ColorGrading.bEnableColorGrading;
+	s_SerializeColorGradingBand(Ar, ColorGrading.Global);
+	s_SerializeColorGradingBand(Ar, ColorGrading.Shadows);
+	s_SerializeColorGradingBand(Ar, ColorGrading.Midtones);
+	s_SerializeColorGradingBand(Ar, ColorGrading.Highlights);
+}
+
+static void s_SerializePreset(FArchive& Ar, UStageAPIImpl::FStagePreset& Preset, uint32 Version)
+{
+	Ar << Preset.PropertyMask;
+	for (EStageAPIProperty Property : TEnumRange<EStageAPIProperty>())
+	{
+		if (Preset.PropertyMask & (1ull << static_cast<uint8>(Property)))
+		{
+			FVector4f StoredValue(Preset.Values[static_cast<uint8>(Property)]);
+			Ar << StoredValue;
+			Preset.Values[static_cast<uint8>(Property)] = FVector4(StoredValue);
+		}
+	}
+
+	s_SerializeColorGrading(Ar, Preset.ClusterColorGrading);
+	s_SerializeColorGrading(Ar, Preset.FrustumColorGrading);
+
+	int32 NumViewports = Preset.Viewports.Num();
+	Ar << NumViewports;
+	if (Ar.IsLoading())
+	{
+		if (NumViewports < 0 || NumViewports > (Ar.TotalSize() - Ar.Tell()) / StagePresetMinViewportSize)
+		{
+			Ar.SetError();
+			return;
+		}
+		Preset.Viewports.SetNum(NumViewports);
+	}
+	for (TPair<FString, FStageAPIViewportRenderSettings>& Viewport : Preset.Viewports)
+	{
+		s_SerializePresetString(Ar, Viewport.Key);
+		Ar << Viewport.Value.BufferRatio << Viewport.Value.RenderTargetRatio;
+		if (Ar.IsError())
+			return;
+	}
+
+	Preset.bHasOverrideFlags = Version >= 2;
+	if (Preset.bHasOverrideFlags)
+	{
+		s_SerializeOverrideFlags(Ar, Preset.ClusterFlags);
+		s_SerializeOverrideFlags(Ar, Preset.CameraFlags[0]);
+		s_SerializeOverrideFlags(Ar, Preset.CameraFlags[1]);
+	}
+}
+
+/**
+ * @brief Properties captured individually. The grade bands are stored as whole grades so override flags survive,
+ * the B camera only when it is a separate camera.
+ */
+static bool s_IsPresetProperty(EStageAPIProperty Property, bool bCameraBActive)
+{
+	if (Property == EStageAPIProperty::None || s_IsColorGradingProperty(Property))
+		return false;
+
+	if (Property >= EStageAPIProperty::FrustumFOVMultB && Property <= EStageAPIProperty::FrustumRotationB)
+		return bCameraBActive;
+
+	return true;
+}
+
+bool UStageAPIImpl::CapturePreset(FName PresetName)
+{
+	STAGEAPI_TRACE(CapturePreset)
+	STAGEAPI_JOURNAL(CapturePreset, PresetName)
+	API_CHECK_BOOL
+
+	//The preset should hold what the user sees, including values still waiting to be flushed
+	ApplyPendingWrites(InteractionDepth > 0);
+
+	FStagePreset Preset;
+	bool const bCameraBActive = CameraBActive();
+	for (EStageAPIProperty Property : TEnumRange<EStageAPIProperty>())
+	{
+		if (s_IsPresetProperty(Property, bCameraBActive))
+		{
+			Preset.PropertyMask |= 1ull << static_cast<uint8>(Property);
+			Preset.Values[static_cast<uint8>(Property)] = GetPropertyValue(Property);
+		}
+	}
+
+	Preset.ClusterColorGrading = GetClusterColorGrading();
+	Preset.FrustumColorGrading = GetFrustumColorGrading();
+
+	FStageOverrideFlags const Flags = CaptureOverrideFlags();
+	Preset.ClusterFlags = Flags.Cluster;
+	Preset.CameraFlags[0] = Flags.CameraFlags[0];
+	Preset.CameraFlags[1] = Flags.CameraFlags[1];
+	Preset.bHasOverrideFlags = true;
+
+	const FStageTopology& Topology = s_GetStageTopology(s_DisplayClusterRoot.Get());
+	for (int32 ViewportIdx = 0; ViewportIdx < Topology.Viewports.Num(); ++ViewportIdx)
+	{
+		if (UDisplayClusterConfigurationViewport* Viewport = Topology.ViewportObjects[ViewportIdx].Get())
+		{
+			Preset.Viewports.Emplace(Topology.ViewportNameStrings[ViewportIdx], s_ReadViewportRenderSettings(Viewport));
+		}
+	}
+
+	StagePresets.Add(PresetName, MoveTemp(Preset));
+	return true;
+}
+
+/**
+ * @brief Applies only the parts of the preset that differ from the live stage, so only the objects that change are
+ * modified. Everything goes out as one transaction.
+ */
+bool UStageAPIImpl::RecallPreset(FName PresetName)
+{
+	STAGEAPI_TRACE(RecallPreset)
+	STAGEAPI_JOURNAL(RecallPreset, PresetName)
+	API_CHECK_BOOL
+
+	const FStagePreset* Preset = StagePresets.Find(PresetName);
+	if (!Preset)
+	{
+		UE_LOG(StageAPIEditor, Warning, TEXT("VP Stage API preset '%s' does not exist"), *PresetName.ToString());
+		return false;
+	}
+
+	//Pending values would land on top of the preset
+	ApplyPendingWrites(InteractionDepth > 0);
+
+	BeginBatch(FString::Printf(TEXT("Recall Stage Preset %s"), *PresetName.ToString()));
+	{
+		TGuardValue<bool> FlushGuard(bFlushingWrites, true);
+
+		bool const bCameraBActive = CameraBActive();
+		for (EStageAPIProperty Property : TEnumRange<EStageAPIProperty>())
+		{
+			if (!(Preset->PropertyMask & (1ull << static_cast<uint8>(Property))) || !s_IsPresetProperty(Property, bCameraBActive))
+				continue;
+
+			FVector4 const& Value = Preset->Values[static_cast<uint8>(Property)];
+			if (!GetPropertyValue(Property).Equals(Value, StagePresetTolerance))
+			{
+				SetPropertyValue(Property, Value);
+			}
+		}
+
+		if (!GetClusterColorGrading().Equals(Preset->ClusterColorGrading, StagePresetTolerance))
+		{
+			SetClusterColorGrading(Preset->ClusterColorGrading);
+		}
+		if (!GetFrustumColorGrading().Equals(Preset->FrustumColorGrading, StagePresetTolerance))
+		{
+			SetFrustumColorGrading(Preset->FrustumColorGrading);
+		}
+
+		//The exposure setters above force their overrides on, the preset's own flags go back last
+		if (Preset->bHasOverrideFlags)
+		{
+			FStageOverrideFlags Flags = CaptureOverrideFlags();
+			Flags.Cluster = Preset->ClusterFlags;
+			Flags.CameraFlags[0] = Preset->CameraFlags[0];
+			Flags.CameraFlags[1] = Preset->CameraFlags[1];
+			if (!bCameraBActive)
+			{
+				Flags.Cameras[1].Reset();
+			}
+			RestoreOverrideFlags(Flags);
+		}
+
+		//Only viewports whose values differ are modified
+		const FStageTopology& Topology = s_GetStageTopology(s_DisplayClusterRoot.Get());
+		s_BeginTransaction(TEXT("Set Viewport Render Settings"), s_DisplayClusterRoot.Get());
+		for (const TPair<FString, FStageAPIViewportRenderSettings>& Viewport : Preset->Viewports)
+		{
+			if (const int32* ViewportIdx = Topology.ViewportIndex.Find(FName(*Viewport.Key, FNAME_Find)))
+			{
+				s_WriteViewportRenderSettings(Topology.ViewportObjects[*ViewportIdx].Get(), Viewport.Value);
+			}
+		}
+		s_EndTransaction();
+	}
+	CommitBatch();
+	return true;
+}
+
+bool UStageAPIImpl::DeletePreset(FName PresetName)
+{
+	STAGEAPI_TRACE(DeletePreset)
+	STAGEAPI_JOURNAL(DeletePreset, PresetName)
+	return StagePresets.Remove(PresetName) > 0;
+}
+
+TArray<FName> UStageAPIImpl::GetPresetNames() const
+{
+	STAGEAPI_TRACE(GetPresetNames)
+	STAGEAPI_JOURNAL(GetPresetNames)
+	TArray<FName> PresetNames;
+	StagePresets.GetKeys(PresetNames);
+	return PresetNames;
+}
+
+static FString s_GetPresetFilePath(const FString& FilePath)
+{
+	return FilePath.IsEmpty() ? FPaths::ProjectSavedDir() / TEXT("VPStageAPI") / TEXT("StagePresets.bin") : FilePath;
+}
+
+bool UStageAPIImpl::SavePresets(const FString& FilePath)
+{
+	STAGEAPI_TRACE(SavePresets)
+	STAGEAPI_JOURNAL(SavePresets, FilePath)
+	TArray<uint8> Bytes;
+	FMemoryWriter Writer(Bytes);
+
+	uint32 Magic = StagePresetFileMagic;
+	uint32 Version = StagePresetFileVersion;
+	int32 NumPresets = StagePresets.Num();
+	Writer << Magic << Version << NumPresets;
+
+	for (TPair<FName, FStagePreset>& Preset : StagePresets)
+	{
+		FString PresetName = Preset.Key.ToString();
+		s_SerializePresetString(Writer, PresetName);
+		s_SerializePreset(Writer, Preset.Value, StagePresetFileVersion);
+	}
+
+	FString const Path = s_GetPresetFilePath(FilePath);
+	if (!FFileHelper::SaveArrayToFile(Bytes, *Path))
+	{
+		UE_LOG(StageAPIEditor, Error, TEXT("VP Stage API could not write presets to '%s'"), *Path);
+		return false;
+	}
+	return true;
+}
+
+/**
+ * @brief Loads a preset file, replacing the presets in memory. A file with an unknown magic or a newer version is
+ * rejected without touching the current presets.
+ */
+bool UStageAPIImpl::LoadPresets(const FString& FilePath)
+{
+	STAGEAPI_TRACE(LoadPresets)
+	STAGEAPI_JOURNAL(LoadPresets, FilePath)
+	FString const Path = s_GetPresetFilePath(FilePath);
+
+	TArray<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *Path))
+	{
+		UE_LOG(StageAPIEditor, Warning, TEXT("VP Stage API could not read presets from '%s'"), *Path);
+		return false;
+	}
+
+	FMemoryReader Reader(Bytes);
+
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	int32 NumPresets = 0;
+	Reader << Magic << Version << NumPresets;
+
+	if (Reader.IsError() || Magic != StagePresetFileMagic || Version > StagePresetFileVersion
+		|| NumPresets < 0 || NumPresets > (Reader.TotalSize() - Reader.Tell()) / StagePresetMinPresetSize)
+	{
+		UE_LOG(StageAPIEditor, Error, TEXT("VP Stage API '%s' is not a supported preset file"), *Path);
+		return false;
+	}
+
+	TMap<FName, FStagePreset> LoadedPresets;
+	for (int32 PresetIdx = 0; PresetIdx < NumPresets && !Reader.IsError(); ++PresetIdx)
+	{
+		FString PresetName;
+		FStagePreset Preset;
+		s_SerializePresetString(Reader, PresetName);
+		if (Reader.IsError())
+			break;
+
+		s_SerializePreset(Reader, Preset, Version);
+		LoadedPresets.Add(FName(*PresetName), MoveTemp(Preset));
+	}
+
+	if (Reader.IsError())
+	{
+		UE_LOG(StageAPIEditor, Error, TEXT("VP Stage API preset file '%s' is truncated or corrupt"), *Path);
+		return false;
+	}
+
+	StagePresets = MoveTemp(LoadedPresets);
+	return true;
+}
+
+#if WITH_DEV_AUTOMATION_TESTS
 
-	GEngine->BeginTransaction(*FString(TEXT(TEXT_API_TAG)), FText::FromString(TEXT("Update ICVFX Color Grade")), s_DisplayClusterRoot.Get());
-	IcvfxComponent->Modify();
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FStageAPIPresetTest, "VPStageAPI.Presets.SaveRecall",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
 
-	if (NewGain.X == 0 && NewGain.Y == 0 && NewGain.Z == 0)
-	{
-		IcvfxComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.Global.bOverride_Gain = false;
-	}
-	else
+/**
+ * @brief Captures a preset with the stage exposure override switched off, round-trips it through a preset file and
+ * recalls it over a changed stage. Runs on its own API instance so the user's presets are left alone, needs an
+ * nDisplay root in the editor level and puts its exposure back afterwards.
+ */
+bool FStageAPIPresetTest::RunTest(const FString& Parameters)
+{
+	TStrongObjectPtr<UStageAPIImpl> API(NewObject<UStageAPIImpl>(GetTransientPackage()));
+	ADisplayClusterRootActor* Root = API->GetDisplayClusterRoot();
+	if (!Root)
 	{
-		IcvfxComponent->CameraSettings.AllNodesColorGrading.bEnableEntireClusterColorGrading = true;
-		IcvfxComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.Global.bOverride_Gain = true;
-		
+		AddWarning(TEXT("No nDisplay root in the editor level, presets were not tested"));
+		return true;
 	}
-	IcvfxComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.Global.Gain = NewGain;
 
-	GEngine->EndTransaction();
+	auto& ClusterColorGrading = Root->GetConfigData()->StageSettings.EntireClusterColorGrading;
+	bool const bOriginalGradingEnabled = ClusterColorGrading.bEnableEntireClusterColorGrading;
+	bool const bOriginalExposureOverride = ClusterColorGrading.ColorGradingSettings.bOverride_AutoExposureBias;
+	float const OriginalExposure = ClusterColorGrading.ColorGradingSettings.AutoExposureBias;
+
+	FName const PresetName(TEXT("VPStageAPI.PresetTest"));
+	FString const PresetFile = FPaths::AutomationTransientDir() / TEXT("StagePresets.bin");
+
+	//An exposure value with its override switched off, recalling the value alone would switch it back on
+	API->SetStageExposure(OriginalExposure + 1.0f);
+	API->DisableStageExposure();
+	TestTrue(TEXT("Preset captured"), API->CapturePreset(PresetName));
+	TestTrue(TEXT("Presets saved"), API->SavePresets(PresetFile));
+
+	API->DeletePreset(PresetName);
+	API->SetStageExposure(OriginalExposure + 2.0f);
+
+	TestTrue(TEXT("Presets loaded"), API->LoadPresets(PresetFile));
+	TestTrue(TEXT("Loaded preset listed"), API->GetPresetNames().Contains(PresetName));
+	TestTrue(TEXT("Preset recalled"), API->RecallPreset(PresetName));
+	TestEqual(TEXT("Recalled stage exposure"), API->GetStageExposure(), OriginalExposure + 1.0f, StagePresetTolerance);
+	TestFalse(TEXT("Recalled exposure override"), static_cast<bool>(ClusterColorGrading.ColorGradingSettings.bOverride_AutoExposureBias));
+
+	Root->GetConfigData()->Modify();
+	ClusterColorGrading.bEnableEntireClusterColorGrading = bOriginalGradingEnabled;
+	ClusterColorGrading.ColorGradingSettings.bOverride_AutoExposureBias = bOriginalExposureOverride;
+	ClusterColorGrading.ColorGradingSettings.AutoExposureBias = OriginalExposure;
+	IFileManager::Get().Delete(*PresetFile);
+	return true;
 }
 
-FVector4 UStageAPIImpl::GetFrustumPP_GlobalOffset() const
-{
-	API_CHECK_VECTOR4
-	
-	auto const IcvfxComponent = GetIcvfxCameraComponentA();
+#endif
 
-	if (!IcvfxComponent)
-		return FVector4();
+#pragma endregion
 
-	return IcvfxComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.Global.Offset;
-}
+#pragma region "Stage State"
 
-void UStageAPIImpl::SetFrustumPP_GlobalOffset(FVector4 NewOffset)
-{
-	API_CHECK_VOID
-	
-	auto const IcvfxComponent = GetIcvfxCameraComponentA();
+//////////////////////////////////////////////////////////////////////////////////////////////
+// Stage State
+//////////////////////////////////////////////////////////////////////////////////////////////
 
+FStageAPIFrustumState UStageAPIImpl::GetFrustumState_ByComponent(UDisplayClusterICVFXCameraComponent* IcvfxComponent) const
+{
+	STAGEAPI_TRACE(GetFrustumState_ByComponent)
+	FStageAPIFrustumState FrustumState;
 	if (!IcvfxComponent)
-		return;
+		return FrustumState;
 
-	GEngine->BeginTransaction(*FString(TEXT(TEXT_API_TAG)), FText::FromString(TEXT("Update ICVFX Color Grade")), s_DisplayClusterRoot.Get());
-	IcvfxComponent->Modify();
+	FrustumState.bValid = true;
+	FrustumState.FOVMult = IcvfxComponent->CameraSettings.BufferRatio;
+	FrustumState.Exposure = IcvfxComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.AutoExposureBias;
 
-	if (NewOffset.X == 0 && NewOffset.Y == 0 && NewOffset.Z == 0)
-	{
-		IcvfxComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.Global.bOverride_Offset = false;
-	}
-	else
+	//Same reads as the _ByComponent getters with the camera actor resolved once
+	if (ACineCameraActor* FrustumCamera = GetFrustumCamera_ByComponent(IcvfxComponent))
 	{
-		IcvfxComponent->CameraSettings.AllNodesColorGrading.bEnableEntireClusterColorGrading = true;
-		IcvfxComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.Global.bOverride_Offset = true;
-		
+		UCineCameraComponent* CineCameraComponent = FrustumCamera->GetCineCameraComponent();
+		FrustumState.Aperture = CineCameraComponent->CurrentAperture;
+		FrustumState.FocalDistance = CineCameraComponent->FocusSettings.ManualFocusDistance;
+		FrustumState.Position = FrustumCamera->GetRootComponent()->GetComponentLocation();
+		FrustumState.Rotation = FrustumCamera->GetRootComponent()->GetRelativeRotation();
 	}
-	IcvfxComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.Global.Offset = NewOffset;
-
-	GEngine->EndTransaction();
+	return FrustumState;
 }
 
-FVector4 UStageAPIImpl::GetFrustumPP_ShadowsGain() const
+/**
+ * @brief Fills the whole stage state with the root, config and ICVFX cameras resolved once. Matches what the
+ * individual getters return.
+ */
+FStageAPIStageState UStageAPIImpl::GetStageState() const
 {
-	API_CHECK_VECTOR4
-	
-	auto const IcvfxComponent = GetIcvfxCameraComponentA();
+	STAGEAPI_TRACE(GetStageState)
+	STAGEAPI_JOURNAL(GetStageState)
+	FStageAPIStageState State;
+	if (!s_EnsureAPISurface())
+		return State;
 
-	if (!IcvfxComponent)
-		return FVector4();
+	ADisplayClusterRootActor* Root = s_DisplayClusterRoot.Get();
+	UDisplayClusterConfigurationData* ConfigData = Root->GetConfigData();
+	const FIcvfxCameraIndex& CameraIndex = s_GetIcvfxCameraIndex(Root);
+	UDisplayClusterICVFXCameraComponent* CameraA = CameraIndex.CameraA.Get();
+	UDisplayClusterICVFXCameraComponent* CameraB = CameraIndex.CameraB.Get();
 
-	return IcvfxComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.Shadows.Gain;
-}
+	State.bValid = true;
 
-void UStageAPIImpl::SetFrustumPP_ShadowsGain(FVector4 NewShadowsGain)
-{
-	API_CHECK_VOID
-	
-	auto const IcvfxComponent = GetIcvfxCameraComponentA();
+	AActor* const StageRoot = Root->GetAttachParentActor() ? Root->GetAttachParentActor() : Root;
+	State.StagePosition = StageRoot->K2_GetActorLocation();
+	State.StageRotation = StageRoot->K2_GetActorRotation();
 
-	if (!IcvfxComponent)
-		return;
+	if (UDisplayClusterCameraComponent* DefaultViewPoint = s_GetDefaultViewPoint(Root))
+	{
+		State.DefaultViewPosition = DefaultViewPoint->GetRelativeLocation();
+	}
 
-	GEngine->BeginTransaction(*FString(TEXT(TEXT_API_TAG)), FText::FromString(TEXT("Update ICVFX Color Grade")), s_DisplayClusterRoot.Get());
-	IcvfxComponent->Modify();
+	if (ConfigData)
+	{
+		State.StageExposure = ConfigData->StageSettings.EntireClusterColorGrading.ColorGradingSettings.AutoExposureBias;
+		State.GlobalScreenPercentage = ConfigData->RenderFrameSettings.ClusterICVFXOuterViewportBufferRatioMult;
+		State.bInnerFrustumEnabled = ConfigData->StageSettings.bEnableInnerFrustums;
 
-	if (NewShadowsGain.X == 0 && NewShadowsGain.Y == 0 && NewShadowsGain.Z == 0)
+		auto const& ClusterColorGrading = ConfigData->StageSettings.EntireClusterColorGrading;
+		State.ClusterColorGrading = s_ReadColorGrading(ClusterColorGrading.ColorGradingSettings, ClusterColorGrading.bEnableEntireClusterColorGrading);
+	}
+
+	State.bCameraBActive = CameraA != CameraB;
+	State.FrustumA = GetFrustumState_ByComponent(CameraA);
+	State.FrustumB = GetFrustumState_ByComponent(CameraB);
+
+	//Same component GetChromakeyStatus reads, which is not necessarily camera A
+	if (UDisplayClusterICVFXCameraComponent* ChromakeyCamera = GetIcvfxCameraComponent())
 	{
-		IcvfxComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.Shadows.bOverride_Gain = false;
+		State.bChromakeyEnabled = ChromakeyCamera->CameraSettings.Chromakey.bEnable;
 	}
-	else
+
+	if (CameraA)
 	{
-		IcvfxComponent->CameraSettings.AllNodesColorGrading.bEnableEntireClusterColorGrading = true;
-		IcvfxComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.Shadows.bOverride_Gain = true;
-		
+		State.FrustumRenderRatio = CameraA->CameraSettings.RenderSettings.AdvancedRenderSettings.RenderTargetRatio;
+
+		auto const& FrustumColorGrading = CameraA->CameraSettings.AllNodesColorGrading;
+		State.FrustumColorGrading = s_ReadColorGrading(FrustumColorGrading.ColorGradingSettings, FrustumColorGrading.bEnableEntireClusterColorGrading);
 	}
-	IcvfxComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.Shadows.Gain = NewShadowsGain;
 
-	GEngine->EndTransaction();
+	return State;
 }
 
-FVector4 UStageAPIImpl::GetFrustumPP_MidsGain() const
-{
-	API_CHECK_VECTOR4
-	
-	auto const IcvfxComponent = GetIcvfxCameraComponentA();
-
-	if (!IcvfxComponent)
-		return FVector4();
+static FStageAPIStageState s_StageStateCache;
+static uint64 s_StageStateCacheFrame = MAX_uint64;
 
-	return IcvfxComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.Midtones.Gain;
+/**
+ * @brief Reads the stage state at most once per engine frame. Changes made later in the same frame show up on the next one.
+ */
+FStageAPIStageState UStageAPIImpl::GetStageStateCached() const
+{
+	STAGEAPI_TRACE(GetStageStateCached)
+	STAGEAPI_JOURNAL(GetStageStateCached)
+	if (s_StageStateCacheFrame != GFrameCounter)
+	{
+		s_StageStateCache = GetStageState();
+		s_StageStateCacheFrame = GFrameCounter;
+	}
+	return s_StageStateCache;
 }
 
-void UStageAPIImpl::SetFrustumPP_MidsGain(FVector4 NewMidsGain)
-{
-	API_CHECK_VOID
-	
-	auto const IcvfxComponent = GetIcvfxCameraComponentA();
+#pragma endregion
 
-	if (!IcvfxComponent)
-		return;
+#pragma region "Sequencer Controls"
 
-	GEngine->BeginTransaction(*FString(TEXT(TEXT_API_TAG)), FText::FromString(TEXT("Update ICVFX Color Grade")), s_DisplayClusterRoot.Get());
-	IcvfxComponent->Modify();
 
-	if (NewMidsGain.X == 0 && NewMidsGain.Y == 0 && NewMidsGain.Z == 0)
+//SEQUENCER TRACKING
+
+/**
+ * @brief Points EditorSequencer at the most recently opened Sequencer that is still alive.
+ */
+static void s_UpdateEditorSequencer()
+{
+	EditorSequencer.Reset();
+	for (int32 Index = s_TrackedSequencers.Num() - 1; Index >= 0; --Index)
 	{
-		IcvfxComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.Midtones.bOverride_Gain = false;
+		if (s_TrackedSequencers[Index].Sequencer.IsValid())
+		{
+			EditorSequencer = s_TrackedSequencers[Index].Sequencer;
+			return;
+		}
 	}
-	else
+}
+
+static void s_HandleSequencerClosed(TSharedRef<ISequencer> Sequencer)
+{
+	s_TrackedSequencers.RemoveAll([&Sequencer](const FTrackedSequencer& Tracked)
 	{
-		IcvfxComponent->CameraSettings.AllNodesColorGrading.bEnableEntireClusterColorGrading = true;
-		IcvfxComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.Midtones.bOverride_Gain = true;
-		
-	}
-	IcvfxComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.Midtones.Gain = NewMidsGain;
+		return !Tracked.Sequencer.IsValid() || Tracked.Sequencer.Pin() == Sequencer;
+	});
 
-	GEngine->EndTransaction();
+	if (EditorSequencer.Pin() == Sequencer || !EditorSequencer.IsValid())
+	{
+		s_UpdateEditorSequencer();
+	}
 }
 
-FVector4 UStageAPIImpl::GetFrustumPP_HighlightsGain() const
+/**
+ * @brief Tracks a Sequencer if it edits a Level Sequence. The newest Sequencer becomes the API target, matching
+ * what the user last opened.
+ */
+static void s_TrackSequencer(TSharedRef<ISequencer> Sequencer)
 {
-	API_CHECK_VECTOR4
-	
-	auto const IcvfxComponent = GetIcvfxCameraComponentA();
+	ULevelSequence* Sequence = Cast<ULevelSequence>(Sequencer->GetRootMovieSceneSequence());
+	if (!Sequence)
+		return;
 
-	if (!IcvfxComponent)
-		return FVector4();
+	for (const FTrackedSequencer& Tracked : s_TrackedSequencers)
+	{
+		if (Tracked.Sequencer.Pin() == Sequencer)
+			return;
+	}
 
-	return IcvfxComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.Highlights.Gain;
+	FTrackedSequencer& Tracked = s_TrackedSequencers.AddDefaulted_GetRef();
+	Tracked.Sequencer = Sequencer;
+	Tracked.Sequence = Sequence;
+	Tracked.OnCloseHandle = Sequencer->OnCloseEvent().AddStatic(&s_HandleSequencerClosed);
+
+	EditorSequencer = Sequencer;
 }
 
-void UStageAPIImpl::SetFrustumPP_HighlightsGain(FVector4 NewHighlightsGain)
+/**
+ * @brief Subscribes to Sequencer creation and picks up the Level Sequence editors that were already open. The
+ * open editor scan only happens once, afterwards Sequencers are tracked through their events.
+ */
+void s_BindSequencerTracking()
 {
-	API_CHECK_VOID
-	
-	auto const IcvfxComponent = GetIcvfxCameraComponentA();
+	STAGEAPI_TRACE(s_BindSequencerTracking)
+	if (s_bSequencerTrackingBound)
+		return;
 
-	if (!IcvfxComponent)
+	ISequencerModule* SequencerModule = FModuleManager::GetModulePtr<ISequencerModule>("Sequencer");
+	if (!SequencerModule || !GEditor)
 		return;
 
-	GEngine->BeginTransaction(*FString(TEXT(TEXT_API_TAG)), FText::FromString(TEXT("Update ICVFX Color Grade")), s_DisplayClusterRoot.Get());
-	IcvfxComponent->Modify();
+	s_bSequencerTrackingBound = true;
+	s_OnSequencerCreatedHandle = SequencerModule->RegisterOnSequencerCreated(FOnSequencerCreated::FDelegate::CreateStatic(&s_TrackSequencer));
 
-	if (NewHighlightsGain.X == 0 && NewHighlightsGain.Y == 0 && NewHighlightsGain.Z == 0)
+	UAssetEditorSubsystem* AssetEditorSubsystem = GEditor->GetEditorSubsystem<UAssetEditorSubsystem>();
+	for (UObject* EditedAsset : AssetEditorSubsystem->GetAllEditedAssets())
 	{
-		IcvfxComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.Highlights.bOverride_Gain = false;
+		if (!EditedAsset->IsA<ULevelSequence>())
+			continue;
+
+		TSharedPtr<IToolkit> Toolkit = FToolkitManager::Get().FindEditorForAsset(EditedAsset);
+		if (Toolkit.IsValid() && Toolkit->GetToolkitFName() == FName("LevelSequenceEditor"))
+		{
+			TSharedPtr<ISequencer> Sequencer = StaticCastSharedPtr<ILevelSequenceEditorToolkit>(Toolkit)->GetSequencer();
+			if (Sequencer.IsValid())
+			{
+				s_TrackSequencer(Sequencer.ToSharedRef());
+			}
+		}
 	}
-	else
+}
+
+void s_UnbindSequencerTracking()
+{
+	if (!s_bSequencerTrackingBound)
+		return;
+
+	if (ISequencerModule* SequencerModule = FModuleManager::GetModulePtr<ISequencerModule>("Sequencer"))
 	{
-		IcvfxComponent->CameraSettings.AllNodesColorGrading.bEnableEntireClusterColorGrading = true;
-		IcvfxComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.Highlights.bOverride_Gain = true;
-		
+		SequencerModule->UnregisterOnSequencerCreated(s_OnSequencerCreatedHandle);
 	}
-	IcvfxComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.Highlights.Gain = NewHighlightsGain;
 
-	GEngine->EndTransaction();
-}
+	for (const FTrackedSequencer& Tracked : s_TrackedSequencers)
+	{
+		if (TSharedPtr<ISequencer> Sequencer = Tracked.Sequencer.Pin())
+		{
+			Sequencer->OnCloseEvent().Remove(Tracked.OnCloseHandle);
+		}
+	}
 
+	s_TrackedSequencers.Reset();
+	EditorSequencer.Reset();
+	s_bSequencerTrackingBound = false;
+}
 
+TArray<ULevelSequence*> UStageAPIImpl::GetOpenLevelSequences() const
+{
+	STAGEAPI_TRACE(GetOpenLevelSequences)
+	STAGEAPI_JOURNAL(GetOpenLevelSequences)
+	s_BindSequencerTracking();
 
-#pragma  endregion
+	TArray<ULevelSequence*> Sequences;
+	for (const FTrackedSequencer& Tracked : s_TrackedSequencers)
+	{
+		if (Tracked.Sequencer.IsValid() && Tracked.Sequence.IsValid())
+		{
+			Sequences.Add(Tracked.Sequence.Get());
+		}
+	}
+	return Sequences;
+}
 
-#pragma region "Sequencer Controls"
+ULevelSequence* UStageAPIImpl::GetActiveLevelSequence() const
+{
+	STAGEAPI_TRACE(GetActiveLevelSequence)
+	STAGEAPI_JOURNAL(GetActiveLevelSequence)
+	API_CHECK_SEQ_NULL
 
+	for (const FTrackedSequencer& Tracked : s_TrackedSequencers)
+	{
+		if (Tracked.Sequencer == EditorSequencer)
+		{
+			return Tracked.Sequence.Get();
+		}
+	}
+	return nullptr;
+}
 
-void s_InitSequencer()
+bool UStageAPIImpl::SetActiveLevelSequence(ULevelSequence* Sequence)
 {
+	STAGEAPI_TRACE(SetActiveLevelSequence)
+	STAGEAPI_JOURNAL(SetActiveLevelSequence, Sequence)
+	s_BindSequencerTracking();
 
-	//TODO: This code is dependent on there being an already open sequence in order to find the Sequencer. We should be able to find the ToolKit directly
-	auto OpenAssets = GEditor->GetEditorSubsystem<UAssetEditorSubsystem>()->GetAllEditedAssets();
-	for (UObject* item : OpenAssets)
+	for (const FTrackedSequencer& Tracked : s_TrackedSequencers)
 	{
-		auto Manager = FToolkitManager::Get().FindEditorForAsset(item);
-		auto ManagerObject = Manager.Get();
-		ILevelSequenceEditorToolkit* LevelSequenceEditorToolkit = (ILevelSequenceEditorToolkit*)(ManagerObject);
-		if (LevelSequenceEditorToolkit)
+		if (Tracked.Sequence.Get() == Sequence && Tracked.Sequencer.IsValid())
 		{
-			auto SequenceToolKitSharedRef = LevelSequenceEditorToolkit->GetSequencer().ToSharedRef();
-			EditorSequencer = TWeakPtr<ISequencer>(SequenceToolKitSharedRef);
-
-			return;
+			EditorSequencer = Tracked.Sequencer;
+			return true;
 		}
 	}
+	return false;
 }
 
 	//SEQUENCER CONTROLS
@@ -1616,6 +4862,8 @@ void s_InitSequencer()
 
 float UStageAPIImpl::GetSequencerTime() const
 {
+	STAGEAPI_TRACE(GetSequencerTime)
+	STAGEAPI_JOURNAL(GetSequencerTime)
 	API_CHECK_SEQ_FLOAT
 
 	auto CurrentPlayheadTime = EditorSequencer.Pin()->GetGlobalTime();
@@ -1624,16 +4872,109 @@ float UStageAPIImpl::GetSequencerTime() const
 
 void UStageAPIImpl::SetSequencerTime(float PlayHeadInSeconds)
 {
+	STAGEAPI_TRACE(SetSequencerTime)
+	STAGEAPI_JOURNAL(SetSequencerTime, PlayHeadInSeconds)
 	API_CHECK_SEQ_VOID
-	
-	FQualifiedFrameTime const CurrentPlayheadTime = EditorSequencer.Pin()->GetGlobalTime();
-	int const PlayHeadPosition = CurrentPlayheadTime.Rate.Numerator * PlayHeadInSeconds;
-	FFrameTime const NewPlayHeadTime = FFrameTime(FFrameNumber(PlayHeadPosition));
-	EditorSequencer.Pin()->SetGlobalTime(NewPlayHeadTime);
+
+	//Global time is in tick resolution. AsFrameTime accounts for the rate denominator (23.976, 29.97 etc.)
+	TSharedPtr<ISequencer> Sequencer = EditorSequencer.Pin();
+	Sequencer->SetGlobalTime(Sequencer->GetRootTickResolution().AsFrameTime(PlayHeadInSeconds));
+}
+
+/**
+ * @brief Converts a time in the given time base to the root tick resolution Sequencer's global time uses.
+ */
+static FFrameTime s_ToSequencerTickTime(const ISequencer& Sequencer, FFrameTime Time, EStageAPISequencerTimeBase TimeBase)
+{
+	if (TimeBase == EStageAPISequencerTimeBase::TickResolution)
+		return Time;
+
+	return FFrameRate::TransformTime(Time, Sequencer.GetRootDisplayRate(), Sequencer.GetRootTickResolution());
+}
+
+static FFrameTime s_FromSequencerTickTime(const ISequencer& Sequencer, FFrameTime Time, EStageAPISequencerTimeBase TimeBase)
+{
+	if (TimeBase == EStageAPISequencerTimeBase::TickResolution)
+		return Time;
+
+	return FFrameRate::TransformTime(Time, Sequencer.GetRootTickResolution(), Sequencer.GetRootDisplayRate());
+}
+
+FFrameTime UStageAPIImpl::GetSequencerFrameTime(EStageAPISequencerTimeBase TimeBase) const
+{
+	STAGEAPI_TRACE(GetSequencerFrameTime)
+	STAGEAPI_JOURNAL(GetSequencerFrameTime, TimeBase)
+	API_CHECK_SEQ_FRAMETIME
+
+	TSharedPtr<ISequencer> Sequencer = EditorSequencer.Pin();
+	return s_FromSequencerTickTime(*Sequencer, Sequencer->GetGlobalTime().Time, TimeBase);
+}
+
+void UStageAPIImpl::SetSequencerFrameTime(FFrameTime Time, EStageAPISequencerTimeBase TimeBase)
+{
+	STAGEAPI_TRACE(SetSequencerFrameTime)
+	STAGEAPI_JOURNAL(SetSequencerFrameTime, Time, TimeBase)
+	API_CHECK_SEQ_VOID
+
+	TSharedPtr<ISequencer> Sequencer = EditorSequencer.Pin();
+	Sequencer->SetGlobalTime(s_ToSequencerTickTime(*Sequencer, Time, TimeBase));
+}
+
+int32 UStageAPIImpl::GetSequencerFrame(EStageAPISequencerTimeBase TimeBase) const
+{
+	STAGEAPI_TRACE(GetSequencerFrame)
+	STAGEAPI_JOURNAL(GetSequencerFrame, TimeBase)
+	return GetSequencerFrameTime(TimeBase).FloorToFrame().Value;
+}
+
+void UStageAPIImpl::SetSequencerFrame(int32 Frame, EStageAPISequencerTimeBase TimeBase)
+{
+	STAGEAPI_TRACE(SetSequencerFrame)
+	STAGEAPI_JOURNAL(SetSequencerFrame, Frame, TimeBase)
+	SetSequencerFrameTime(FFrameTime(FFrameNumber(Frame)), TimeBase);
+}
+
+FTimecode UStageAPIImpl::GetSequencerTimecode() const
+{
+	STAGEAPI_TRACE(GetSequencerTimecode)
+	STAGEAPI_JOURNAL(GetSequencerTimecode)
+	API_CHECK_SEQ_TIMECODE
+
+	TSharedPtr<ISequencer> Sequencer = EditorSequencer.Pin();
+	FFrameRate const DisplayRate = Sequencer->GetRootDisplayRate();
+	FFrameNumber const DisplayFrame = s_FromSequencerTickTime(*Sequencer, Sequencer->GetGlobalTime().Time, EStageAPISequencerTimeBase::DisplayRate).FloorToFrame();
+	return FTimecode::FromFrameNumber(DisplayFrame, DisplayRate, FTimecode::IsDropFormatTimecodeSupported(DisplayRate));
+}
+
+void UStageAPIImpl::SetSequencerTimecode(FTimecode Timecode)
+{
+	STAGEAPI_TRACE(SetSequencerTimecode)
+	STAGEAPI_JOURNAL(SetSequencerTimecode, Timecode)
+	API_CHECK_SEQ_VOID
+
+	//Timecode counts display rate frames, drop frame timecode skips frame labels so it must go through ToFrameNumber
+	TSharedPtr<ISequencer> Sequencer = EditorSequencer.Pin();
+	FFrameNumber const DisplayFrame = Timecode.ToFrameNumber(Sequencer->GetRootDisplayRate());
+	Sequencer->SetGlobalTime(s_ToSequencerTickTime(*Sequencer, FFrameTime(DisplayFrame), EStageAPISequencerTimeBase::DisplayRate));
+}
+
+void UStageAPIImpl::SeekAndPlaySequencer(FFrameTime Time, EStageAPISequencerTimeBase TimeBase)
+{
+	STAGEAPI_TRACE(SeekAndPlaySequencer)
+	STAGEAPI_JOURNAL(SeekAndPlaySequencer, Time, TimeBase)
+	API_CHECK_SEQ_VOID
+
+	//Switching to playing first makes the seek the evaluation playback starts from. Seeking then calling OnPlay
+	//evaluates twice, and OnPlay evaluates again if the old playhead sat at the end of the range.
+	TSharedPtr<ISequencer> Sequencer = EditorSequencer.Pin();
+	Sequencer->SetPlaybackStatus(EMovieScenePlayerStatus::Playing);
+	Sequencer->SetGlobalTime(s_ToSequencerTickTime(*Sequencer, Time, TimeBase));
 }
 
 void UStageAPIImpl::ResetSequencer()
 {
+	STAGEAPI_TRACE(ResetSequencer)
+	STAGEAPI_JOURNAL(ResetSequencer)
 	API_CHECK_SEQ_VOID
 
 	EditorSequencer.Pin()->Pause();
@@ -1642,6 +4983,8 @@ void UStageAPIImpl::ResetSequencer()
 
 void UStageAPIImpl::PlaySequencer()
 {
+	STAGEAPI_TRACE(PlaySequencer)
+	STAGEAPI_JOURNAL(PlaySequencer)
 	API_CHECK_SEQ_VOID
 	//UE_LOG(LogTemp,Warning,TEXT("ENTERED PLAYSEQUENCER"))
 
@@ -1650,6 +4993,8 @@ void UStageAPIImpl::PlaySequencer()
 
 void UStageAPIImpl::PauseSequencer()
 {
+	STAGEAPI_TRACE(PauseSequencer)
+	STAGEAPI_JOURNAL(PauseSequencer)
 	API_CHECK_SEQ_VOID
 
 	EditorSequencer.Pin()->Pause();
@@ -1657,6 +5002,8 @@ void UStageAPIImpl::PauseSequencer()
 
 float UStageAPIImpl::GetSequencerSpeed() const
 {
+	STAGEAPI_TRACE(GetSequencerSpeed)
+	STAGEAPI_JOURNAL(GetSequencerSpeed)
 	API_CHECK_SEQ_FLOAT
 
 	return EditorSequencer.Pin()->GetPlaybackSpeed();
@@ -1664,6 +5011,8 @@ float UStageAPIImpl::GetSequencerSpeed() const
 
 void UStageAPIImpl::SetSequencerSpeed(float Speed)
 {
+	STAGEAPI_TRACE(SetSequencerSpeed)
+	STAGEAPI_JOURNAL(SetSequencerSpeed, Speed)
 	API_CHECK_SEQ_VOID
 
 	EditorSequencer.Pin()->SetPlaybackSpeed(Speed);
@@ -1671,6 +5020,8 @@ void UStageAPIImpl::SetSequencerSpeed(float Speed)
 
 bool UStageAPIImpl::GetSequencerLoop() const
 {
+	STAGEAPI_TRACE(GetSequencerLoop)
+	STAGEAPI_JOURNAL(GetSequencerLoop)
 	API_CHECK_SEQ_BOOL
 
 	return
@@ -1679,6 +5030,8 @@ bool UStageAPIImpl::GetSequencerLoop() const
 
 void UStageAPIImpl::SetSequencerLoop(bool IsLooping)
 {
+	STAGEAPI_TRACE(SetSequencerLoop)
+	STAGEAPI_JOURNAL(SetSequencerLoop, IsLooping)
 	API_CHECK_SEQ_VOID
 
 	EditorSequencer.Pin()->GetSequencerSettings()->SetLoopMode(IsLooping ? ESequencerLoopMode::SLM_Loop : ESequencerLoopMode::SLM_NoLoop);
@@ -1687,6 +5040,8 @@ void UStageAPIImpl::SetSequencerLoop(bool IsLooping)
 
 void UStageAPIImpl::CloseSequencer()
 {
+	STAGEAPI_TRACE(CloseSequencer)
+	STAGEAPI_JOURNAL(CloseSequencer)
 	API_CHECK_SEQ_VOID
 
 	GEditor->GetEditorSubsystem<UAssetEditorSubsystem>()->CloseAllEditorsForAsset(EditorSequencer.Pin()->GetRootMovieSceneSequence());
@@ -1695,6 +5050,8 @@ void UStageAPIImpl::CloseSequencer()
 
 bool UStageAPIImpl::LoadLevelSequencer(ALevelSequenceActor* LevelSequenceActor)
 {
+	STAGEAPI_TRACE(LoadLevelSequencer)
+	STAGEAPI_JOURNAL(LoadLevelSequencer, LevelSequenceActor)
 	//TODO: Urgent, find out how UE5 want to load level sequences.
 	ULevelSequence* Sequence = Cast<ULevelSequence>(LevelSequenceActor->LevelSequence_DEPRECATED.TryLoad());
 
@@ -1708,12 +5065,83 @@ bool UStageAPIImpl::LoadLevelSequencer(ALevelSequenceActor* LevelSequenceActor)
 
 bool UStageAPIImpl::IsSequencerPlaying() const
 {
+	STAGEAPI_TRACE(IsSequencerPlaying)
+	STAGEAPI_JOURNAL(IsSequencerPlaying)
 	API_CHECK_SEQ_BOOL
 
 	return
 		(EditorSequencer.Pin()->GetPlaybackStatus() == EMovieScenePlayerStatus::Playing) ?  true :  false;
 }
 
+static EStageAPIPlaybackStatus s_ToStageAPIPlaybackStatus(EMovieScenePlayerStatus::Type Status)
+{
+	switch (Status)
+	{
+	case EMovieScenePlayerStatus::Playing:		return EStageAPIPlaybackStatus::Playing;
+	case EMovieScenePlayerStatus::Scrubbing:	return EStageAPIPlaybackStatus::Scrubbing;
+	case EMovieScenePlayerStatus::Jumping:		return EStageAPIPlaybackStatus::Jumping;
+	case EMovieScenePlayerStatus::Stepping:		return EStageAPIPlaybackStatus::Stepping;
+	case EMovieScenePlayerStatus::Paused:		return EStageAPIPlaybackStatus::Paused;
+	default:									return EStageAPIPlaybackStatus::Stopped;
+	}
+}
+
+FStageAPISequencerStatus UStageAPIImpl::GetSequencerStatus() const
+{
+	STAGEAPI_TRACE(GetSequencerStatus)
+	STAGEAPI_JOURNAL(GetSequencerStatus)
+	FStageAPISequencerStatus Status;
+
+	INC_DWORD_STAT(STAT_StageAPI_SequencerLookups); if (!s_bSequencerTrackingBound) { s_BindSequencerTracking(); }
+	TSharedPtr<ISequencer> Sequencer = EditorSequencer.Pin();
+	if (!Sequencer.IsValid())
+		return Status;
+
+	FQualifiedFrameTime const GlobalTime = Sequencer->GetGlobalTime();
+
+	Status.bValid = true;
+	Status.TickResolution = GlobalTime.Rate;
+	Status.DisplayRate = Sequencer->GetRootDisplayRate();
+	Status.TimeSeconds = GlobalTime.AsSeconds();
+	Status.DisplayFrameTime = FFrameRate::TransformTime(GlobalTime.Time, Status.TickResolution, Status.DisplayRate);
+	Status.DisplayFrame = Status.DisplayFrameTime.FloorToFrame().Value;
+	Status.PlaybackSpeed = Sequencer->GetPlaybackSpeed();
+	ESequencerLoopMode const LoopMode = Sequencer->GetSequencerSettings()->GetLoopMode();
+	Status.bLooping = LoopMode != ESequencerLoopMode::SLM_NoLoop;
+	if (UMovieScene* MovieScene = Sequencer->GetRootMovieSceneSequence() ? Sequencer->GetRootMovieSceneSequence()->GetMovieScene() : nullptr)
+	{
+		//Sequencer falls back to the playback range when there is no selection to loop
+		TRange<FFrameNumber> LoopRange = MovieScene->GetPlaybackRange();
+		if (LoopMode == ESequencerLoopMode::SLM_LoopSelectionRange && !MovieScene->GetSelectionRange().IsEmpty())
+		{
+			LoopRange = MovieScene->GetSelectionRange();
+		}
+		Status.LoopStartFrameTime = FFrameRate::TransformTime(UE::MovieScene::DiscreteInclusiveLower(LoopRange), Status.TickResolution, Status.DisplayRate);
+		Status.LoopEndFrameTime = FFrameRate::TransformTime(UE::MovieScene::DiscreteExclusiveUpper(LoopRange), Status.TickResolution, Status.DisplayRate);
+	}
+	Status.PlaybackStatus = s_ToStageAPIPlaybackStatus(Sequencer->GetPlaybackStatus());
+	Status.Sequence = Cast<ULevelSequence>(Sequencer->GetRootMovieSceneSequence());
+	return Status;
+}
+
+static FStageAPISequencerStatus s_SequencerStatusCache;
+static uint64 s_SequencerStatusCacheFrame = MAX_uint64;
+
+/**
+ * @brief Reads the status at most once per engine frame. Polling widgets share the first read of the frame.
+ */
+FStageAPISequencerStatus UStageAPIImpl::GetSequencerStatusCached() const
+{
+	STAGEAPI_TRACE(GetSequencerStatusCached)
+	STAGEAPI_JOURNAL(GetSequencerStatusCached)
+	if (s_SequencerStatusCacheFrame != GFrameCounter)
+	{
+		s_SequencerStatusCache = GetSequencerStatus();
+		s_SequencerStatusCacheFrame = GFrameCounter;
+	}
+	return s_SequencerStatusCache;
+}
+
 #pragma  endregion
 
 
@@ -1722,6 +5150,8 @@ bool UStageAPIImpl::IsSequencerPlaying() const
 //Send a Take Recorder Start Message via MultiUser
 bool UStageAPIImpl::SendMUMessage_TakeRecordStart()
 {
+	STAGEAPI_TRACE(SendMUMessage_TakeRecordStart)
+	STAGEAPI_JOURNAL(SendMUMessage_TakeRecordStart)
 	if (TSharedPtr<IConcertSyncClient> ConcertSyncClient = IConcertSyncClientModule::Get().GetClient(TEXT("MultiUser")))
 			{
 				IConcertClientRef ConcertClient = ConcertSyncClient->GetConcertClient();
@@ -1782,6 +5212,8 @@ bool UStageAPIImpl::SendMUMessage_TakeRecordStart()
 //Send a Take Recorder Stop Message via MultiUser
 void UStageAPIImpl::SendMUMessage_TakeRecordStop() 
 {
+	STAGEAPI_TRACE(SendMUMessage_TakeRecordStop)
+	STAGEAPI_JOURNAL(SendMUMessage_TakeRecordStop)
 	if (TSharedPtr<IConcertSyncClient> ConcertSyncClient = IConcertSyncClientModule::Get().GetClient(TEXT("MultiUser")))
 	{
 		IConcertClientRef ConcertClient = ConcertSyncClient->GetConcertClient();
@@ -1802,6 +5234,8 @@ void UStageAPIImpl::SendMUMessage_TakeRecordStop()
 
 #pragma endregion //END API Calls
 
+#undef LOCTEXT_NAMESPACE
+
 
 
 
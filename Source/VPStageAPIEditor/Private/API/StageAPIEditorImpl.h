@@ -3,11 +3,14 @@
 #include "CoreMinimal.h"
 #include "../Public/API/IStageAPIEditor.h"
 #include "LevelSequenceActor.h"
+#include "Containers/Ticker.h"
 #include "StageAPIEditorImpl.generated.h"
 
 
 class ADisplayClusterRootActor;
 class UDisplayClusterICVFXCameraComponent;
+class ULevelSequence;
+struct FStageTopology;
 
 UCLASS()
 class VPSTAGEAPIEDITOR_API UStageAPIImpl
@@ -30,6 +33,268 @@ public:
 	    Category = "VP Stage API")
     virtual bool InitAPISurface() override;
 
+	//Number of times the API has rescanned the world for a nDisplay root. Rescans only happen when the stage topology changes
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Get API Rescan Count"), Category = "VP Stage API")
+	virtual int32 GetAPISurfaceRescanCount() const override;
+
+
+#pragma region "Batching"
+
+	//////////////////////////////////////////////////////////////////////////////////////////////
+	// Batching
+	//////////////////////////////////////////////////////////////////////////////////////////////
+
+	////** Opens a batch. All API setters until the matching CommitBatch are recorded as one transaction */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Begin Batch"), Category = "VP Stage API|Batch")
+	virtual void BeginBatch(const FString& Description) override;
+
+	////** Closes the batch and sends it to the Multi-User session as a single transaction */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Commit Batch"), Category = "VP Stage API|Batch")
+	virtual void CommitBatch() override;
+
+	////** Returns true while a batch is open */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Is Batch Open"), Category = "VP Stage API|Batch")
+	virtual bool IsBatchOpen() const override;
+
+#pragma endregion
+
+#pragma region "Property Access & Write Coalescing"
+
+	//////////////////////////////////////////////////////////////////////////////////////////////
+	// Property Access
+	//
+	//Generic access to the stage parameters listed in EStageAPIProperty. Scalars use X, bools X != 0,
+	//vectors XYZ and rotators (Pitch, Yaw, Roll).
+	//////////////////////////////////////////////////////////////////////////////////////////////
+
+	////** Reads a stage parameter */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Get Property Value"), Category = "VP Stage API|Properties")
+	virtual FVector4 GetPropertyValue(EStageAPIProperty Property) const override;
+
+	////** Writes a stage parameter through its regular setter */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Set Property Value"), Category = "VP Stage API|Properties")
+	virtual void SetPropertyValue(EStageAPIProperty Property, FVector4 Value) override;
+
+	//////////////////////////////////////////////////////////////////////////////////////////////
+	// Write Coalescing
+	//
+	//For slider driven setters. While coalescing is enabled setters only store the latest value per property,
+	//pending values are applied together once per editor tick (FlushRate 0) or FlushRate times per second.
+	//////////////////////////////////////////////////////////////////////////////////////////////
+
+	////** Enables latest-value-wins coalescing of setter calls. FlushRate is in Hz, 0 flushes every editor tick */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Set Write Coalescing"), Category = "VP Stage API|Write Coalescing")
+	virtual void SetWriteCoalescing(bool bEnabled, float FlushRate = 0) override;
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Is Write Coalescing Enabled"), Category = "VP Stage API|Write Coalescing")
+	virtual bool IsWriteCoalescingEnabled() const override;
+
+	////** Applies all pending values now */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Flush Pending Writes"), Category = "VP Stage API|Write Coalescing")
+	virtual void FlushPendingWrites() override;
+
+	////** Starts an interaction (e.g. slider drag). Values are previewed locally and only committed by EndInteraction */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Begin Interaction"), Category = "VP Stage API|Write Coalescing")
+	virtual void BeginInteraction() override;
+
+	////** Ends the interaction and commits the final values as a single transaction */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "End Interaction"), Category = "VP Stage API|Write Coalescing")
+	virtual void EndInteraction() override;
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Is Interaction Active"), Category = "VP Stage API|Write Coalescing")
+	virtual bool IsInteractionActive() const override;
+
+#pragma endregion
+
+#pragma region "Preview Sessions"
+
+	//////////////////////////////////////////////////////////////////////////////////////////////
+	// Preview Sessions
+	//
+	//Between BeginPreviewSession and Commit/CancelPreviewSession all API setters (exposure, FOV mult, render ratio,
+	//grades, chromakey, stage transform etc.) are applied locally at frame rate without transactions.
+	//////////////////////////////////////////////////////////////////////////////////////////////
+
+	////** Snapshots the stage and starts previewing edits locally. Returns false if a session is already open */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Begin Preview Session"), Category = "VP Stage API|Preview")
+	virtual bool BeginPreviewSession() override;
+
+	////** Ends the session and sends the net change against the snapshot as a single transaction */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Commit Preview Session"), Category = "VP Stage API|Preview")
+	virtual void CommitPreviewSession() override;
+
+	////** Ends the session and restores the snapshot */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Cancel Preview Session"), Category = "VP Stage API|Preview")
+	virtual void CancelPreviewSession() override;
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Is Preview Session Active"), Category = "VP Stage API|Preview")
+	virtual bool IsPreviewSessionActive() const override;
+
+#pragma endregion
+
+#pragma region "Transitions"
+
+	//////////////////////////////////////////////////////////////////////////////////////////////
+	// Transitions
+	//
+	//Eased changes of any numeric property (float, FVector, FRotator, FVector4 in the EStageAPIProperty layout) over
+	//time. Intermediate frames are applied locally, undo and Multi-User only receive the start and end values.
+	//////////////////////////////////////////////////////////////////////////////////////////////
+
+	////** Moves a property to TargetValue over Duration seconds. Starting again on the same property retargets it from its current value */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Start Transition", AdvancedDisplay = "BlendExp,Steps"), Category = "VP Stage API|Transitions")
+	virtual bool StartTransition(EStageAPIProperty Property, FVector4 TargetValue, float Duration, TEnumAsByte<EEasingFunc::Type> Easing = EEasingFunc::Linear, float BlendExp = 2.0f, int32 Steps = 2) override;
+
+	////** Stops a transition and records it, either at its current value or at its target */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Cancel Transition"), Category = "VP Stage API|Transitions")
+	virtual void CancelTransition(EStageAPIProperty Property, bool bJumpToEnd = false) override;
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Cancel All Transitions"), Category = "VP Stage API|Transitions")
+	virtual void CancelAllTransitions(bool bJumpToEnd = false) override;
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Is Transition Active"), Category = "VP Stage API|Transitions")
+	virtual bool IsTransitionActive(EStageAPIProperty Property) const override;
+
+#pragma endregion
+
+#pragma region "Root Registry"
+
+	//////////////////////////////////////////////////////////////////////////////////////////////
+	// Root Registry
+	//
+	//For stages with several nDisplay roots. Roots are addressed by actor name or outliner label and can be
+	//grouped by actor tag. All other API calls target the active root or the root pushed with PushTargetRoot.
+	//////////////////////////////////////////////////////////////////////////////////////////////
+
+	////** Actor names of every nDisplay root in the world, sorted */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Get Root Names"), Category = "VP Stage API|Roots")
+	virtual TArray<FName> GetRootNames() const override;
+
+	////** Actor names of the nDisplay roots carrying the given actor tag */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Get Root Names With Tag"), Category = "VP Stage API|Roots")
+	virtual TArray<FName> GetRootNamesWithTag(FName Tag) const override;
+
+	////** Finds a root by actor name or label */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Find Root"), Category = "VP Stage API|Roots")
+	virtual ADisplayClusterRootActor* FindRoot(FName RootName) const override;
+
+	////** Selects the root that API calls target. Kept across rescans while the root exists */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Set Active Root"), Category = "VP Stage API|Roots")
+	virtual bool SetActiveRoot(FName RootName) override;
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Get Active Root Name"), Category = "VP Stage API|Roots")
+	virtual FName GetActiveRootName() const override;
+
+	////** Temporarily targets API calls at another root until the matching PopTargetRoot. Returns false if the root was not found */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Push Target Root"), Category = "VP Stage API|Roots")
+	virtual bool PushTargetRoot(FName RootName) override;
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Pop Target Root"), Category = "VP Stage API|Roots")
+	virtual void PopTargetRoot() override;
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Get Property Value On Root"), Category = "VP Stage API|Roots")
+	virtual FVector4 GetPropertyValueOnRoot(FName RootName, EStageAPIProperty Property) override;
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Set Property Value On Root"), Category = "VP Stage API|Roots")
+	virtual bool SetPropertyValueOnRoot(FName RootName, EStageAPIProperty Property, FVector4 Value) override;
+
+	////** Sets a stage parameter on every root as a single transaction */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Set Property Value On All Roots"), Category = "VP Stage API|Roots")
+	virtual void SetPropertyValueOnAllRoots(EStageAPIProperty Property, FVector4 Value) override;
+
+	////** Sets a stage parameter on every root with the given actor tag as a single transaction */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Set Property Value On Roots With Tag"), Category = "VP Stage API|Roots")
+	virtual void SetPropertyValueOnRootsWithTag(FName Tag, EStageAPIProperty Property, FVector4 Value) override;
+
+#pragma endregion
+
+#pragma region "Viewport Render Settings"
+
+	//////////////////////////////////////////////////////////////////////////////////////////////
+	// Viewport Render Settings & Render Tiers
+	//
+	//Per viewport screen percentage for trimming render cost on parts of the volume (e.g. ceiling) without
+	//touching the main wall. Each call is a single transaction. Render tiers are named profiles matched against
+	//viewport names, built in tiers are "full", "rehearsal" and "ceiling-low".
+	//////////////////////////////////////////////////////////////////////////////////////////////
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Get Viewport Render Settings"), Category = "VP Stage API|Render Tiers")
+	virtual FStageAPIViewportRenderSettings GetViewportRenderSettings(const FString& ViewportName) const override;
+
+	////** Sets the render settings of every listed viewport in one transaction */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Set Viewport Render Settings"), Category = "VP Stage API|Render Tiers")
+	virtual void SetViewportRenderSettings(const TArray<FString>& ViewportNames, FStageAPIViewportRenderSettings Settings) override;
+
+	////** Sets the render settings of every viewport on a cluster node in one transaction */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Set Node Render Settings"), Category = "VP Stage API|Render Tiers")
+	virtual void SetNodeRenderSettings(const FString& NodeName, FStageAPIViewportRenderSettings Settings) override;
+
+	////** Adds or replaces a render tier. Replacing a built in tier name overrides it */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Set Render Tier"), Category = "VP Stage API|Render Tiers")
+	virtual void SetRenderTier(FName TierName, const FStageAPIRenderTier& Tier) override;
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Get Render Tier Names"), Category = "VP Stage API|Render Tiers")
+	virtual TArray<FName> GetRenderTierNames() const override;
+
+	////** Applies a render tier to the stage in one transaction. Returns false if the tier does not exist */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Apply Render Tier"), Category = "VP Stage API|Render Tiers")
+	virtual bool ApplyRenderTier(FName TierName) override;
+
+	////** The last tier applied through the API, None if no tier has been applied */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Get Active Render Tier"), Category = "VP Stage API|Render Tiers")
+	virtual FName GetActiveRenderTier() const override;
+
+#pragma endregion
+
+#pragma region "Stage State"
+
+	//////////////////////////////////////////////////////////////////////////////////////////////
+	// Stage State
+	//////////////////////////////////////////////////////////////////////////////////////////////
+
+	////** Stage transform, default view, both frustums, grades, chromakey and screen percentages in a single call */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Get Stage State"), Category = "VP Stage API|Stage State")
+	virtual FStageAPIStageState GetStageState() const override;
+
+	////** As Get Stage State, but read once per frame and shared by every caller in that frame */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Get Stage State (Cached)"), Category = "VP Stage API|Stage State")
+	virtual FStageAPIStageState GetStageStateCached() const override;
+
+#pragma endregion
+
+#pragma region "Presets"
+
+	//////////////////////////////////////////////////////////////////////////////////////////////
+	// Stage Presets
+	//
+	//A preset holds the stage transform, default view, exposure, both frustums, both grades and the screen
+	//percentages and viewport render settings. Recall only touches what differs and is one transaction.
+	//////////////////////////////////////////////////////////////////////////////////////////////
+
+	////** Captures the live stage into a named preset, replacing a preset with the same name */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Capture Preset"), Category = "VP Stage API|Presets")
+	virtual bool CapturePreset(FName PresetName) override;
+
+	////** Applies a preset in one transaction. Returns false if the preset does not exist */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Recall Preset"), Category = "VP Stage API|Presets")
+	virtual bool RecallPreset(FName PresetName) override;
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Delete Preset"), Category = "VP Stage API|Presets")
+	virtual bool DeletePreset(FName PresetName) override;
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Get Preset Names"), Category = "VP Stage API|Presets")
+	virtual TArray<FName> GetPresetNames() const override;
+
+	////** Writes all presets to a binary file. An empty path uses Saved/VPStageAPI/StagePresets.bin */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Save Presets"), Category = "VP Stage API|Presets")
+	virtual bool SavePresets(const FString& FilePath) override;
+
+	////** Replaces the presets in memory with the ones in the file. An empty path uses Saved/VPStageAPI/StagePresets.bin */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Load Presets"), Category = "VP Stage API|Presets")
+	virtual bool LoadPresets(const FString& FilePath) override;
+
+#pragma endregion
+
 
 #pragma region "nDisplay API"
 	
@@ -74,6 +339,18 @@ public:
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Get Viewport Names"), Category = "VP Stage API|nDisplay")
 	virtual TArray<FString> GetViewportNames() const override;
 
+	////Returns the list of cluster nodes registered in the cluster
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Get Cluster Node Names"), Category = "VP Stage API|nDisplay")
+	virtual TArray<FString> GetClusterNodeNames() const override;
+
+	////Returns the cluster node that renders the viewport, empty if the viewport is unknown
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Get Viewport Node Name"), Category = "VP Stage API|nDisplay")
+	virtual FString GetViewportNodeName(const FString& ViewportName) const override;
+
+	////Changes every time the active root's cluster nodes or viewports change or another root becomes active, 0 without a root. Cache node/viewport lists against this value
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Get Topology Generation"), Category = "VP Stage API|nDisplay")
+	virtual int32 GetTopologyGeneration() const override;
+
 	////** Get the Viewport screen percentage multiplier. */
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Get Global Screen Percentage"), Category = "VP Stage API|nDisplay")
 	virtual float GetGlobalScreenPercentage() const override;
@@ -120,6 +397,10 @@ public:
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Set Default View Position"), Category = "VP Stage API|nDisplay")
 	virtual void SetDefaultViewPosition(FVector NewPosition) override;
 
+	////** Set the default view position locally without a transaction or undo record. For tracking the viewer every frame, not synced to Multi-User */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Set Default View Position (Preview)"), Category = "VP Stage API|nDisplay")
+	virtual void SetDefaultViewPositionPreview(FVector NewPosition) override;
+
 
 	
 #pragma endregion
@@ -469,6 +750,24 @@ public:
 	UFUNCTION(BlueprintCallable, meta=(DisplayName="Set Frustum Highlights Gain"), Category="VP Stage API|Image & Color")
 	virtual void SetFrustumPP_HighlightsGain(FVector4 NewHighlightsGain) override;
 
+	//WHOLE GRADE FUNCTIONS
+
+	//Get the full Cluster grade (Global, Shadows, Midtones & Highlights including override flags)
+	UFUNCTION(BlueprintCallable, meta=(DisplayName="Get Cluster Color Grading"), Category="VP Stage API|Image & Color")
+	virtual FStageAPIColorGrading GetClusterColorGrading() const override;
+
+	//Set the full Cluster grade in a single transaction
+	UFUNCTION(BlueprintCallable, meta=(DisplayName="Set Cluster Color Grading"), Category="VP Stage API|Image & Color")
+	virtual void SetClusterColorGrading(const FStageAPIColorGrading& NewColorGrading) override;
+
+	//Get the full Frustum grade (Global, Shadows, Midtones & Highlights including override flags)
+	UFUNCTION(BlueprintCallable, meta=(DisplayName="Get Frustum Color Grading"), Category="VP Stage API|Image & Color")
+	virtual FStageAPIColorGrading GetFrustumColorGrading() const override;
+
+	//Set the full Frustum grade in a single transaction
+	UFUNCTION(BlueprintCallable, meta=(DisplayName="Set Frustum Color Grading"), Category="VP Stage API|Image & Color")
+	virtual void SetFrustumColorGrading(const FStageAPIColorGrading& NewColorGrading) override;
+
 
 #pragma  endregion 
 
@@ -483,6 +782,32 @@ public:
 	UFUNCTION(BlueprintCallable, meta=(DisplayName="Set Sequencer Position Seconds"), Category="VP Stage API|Sequencer")
 	virtual void SetSequencerTime (float PlayHeadInSeconds) override;
 
+	////** Playhead position in the display rate (UI frames) or the tick resolution */
+	UFUNCTION(BlueprintCallable, meta=(DisplayName="Get Sequencer Frame Time"), Category="VP Stage API|Sequencer")
+	virtual FFrameTime GetSequencerFrameTime(EStageAPISequencerTimeBase TimeBase) const override;
+
+	////** Moves the playhead to a frame time in the display rate or the tick resolution */
+	UFUNCTION(BlueprintCallable, meta=(DisplayName="Set Sequencer Frame Time"), Category="VP Stage API|Sequencer")
+	virtual void SetSequencerFrameTime(FFrameTime Time, EStageAPISequencerTimeBase TimeBase) override;
+
+	UFUNCTION(BlueprintCallable, meta=(DisplayName="Get Sequencer Frame"), Category="VP Stage API|Sequencer")
+	virtual int32 GetSequencerFrame(EStageAPISequencerTimeBase TimeBase) const override;
+
+	UFUNCTION(BlueprintCallable, meta=(DisplayName="Set Sequencer Frame"), Category="VP Stage API|Sequencer")
+	virtual void SetSequencerFrame(int32 Frame, EStageAPISequencerTimeBase TimeBase) override;
+
+	////** Playhead position as timecode in the sequence's display rate, drop frame where the rate supports it */
+	UFUNCTION(BlueprintCallable, meta=(DisplayName="Get Sequencer Timecode"), Category="VP Stage API|Sequencer")
+	virtual FTimecode GetSequencerTimecode() const override;
+
+	////** Moves the playhead to a sequence timecode in the display rate */
+	UFUNCTION(BlueprintCallable, meta=(DisplayName="Set Sequencer Timecode"), Category="VP Stage API|Sequencer")
+	virtual void SetSequencerTimecode(FTimecode Timecode) override;
+
+	////** Starts playback from the given time with a single Sequencer evaluation */
+	UFUNCTION(BlueprintCallable, meta=(DisplayName="Seek And Play Sequencer"), Category="VP Stage API|Sequencer")
+	virtual void SeekAndPlaySequencer(FFrameTime Time, EStageAPISequencerTimeBase TimeBase) override;
+
 	UFUNCTION(BlueprintCallable, meta=(DisplayName="Reset Sequencer"), Category="VP Stage API|Sequencer")
 	virtual void ResetSequencer()override;
 
@@ -513,6 +838,26 @@ public:
 	UFUNCTION(BlueprintCallable, meta=(DisplayName="Is Sequencer Playing"), Category="VP Stage API|Sequencer")
 	virtual bool IsSequencerPlaying () const override;
 
+	////** Time, frame, rates, speed, loop mode, playback status and loaded sequence in a single call */
+	UFUNCTION(BlueprintCallable, meta=(DisplayName="Get Sequencer Status"), Category="VP Stage API|Sequencer")
+	virtual FStageAPISequencerStatus GetSequencerStatus() const override;
+
+	////** As Get Sequencer Status, but read once per frame and shared by every caller in that frame */
+	UFUNCTION(BlueprintCallable, meta=(DisplayName="Get Sequencer Status (Cached)"), Category="VP Stage API|Sequencer")
+	virtual FStageAPISequencerStatus GetSequencerStatusCached() const override;
+
+	////** Level Sequences currently open in Sequencer, oldest first */
+	UFUNCTION(BlueprintCallable, meta=(DisplayName="Get Open Level Sequences"), Category="VP Stage API|Sequencer")
+	virtual TArray<ULevelSequence*> GetOpenLevelSequences() const override;
+
+	////** The Level Sequence the Sequencer controls act on. Defaults to the most recently opened one */
+	UFUNCTION(BlueprintCallable, meta=(DisplayName="Get Active Level Sequence"), Category="VP Stage API|Sequencer")
+	virtual ULevelSequence* GetActiveLevelSequence() const override;
+
+	////** Targets the Sequencer controls at an open Level Sequence. Returns false if it is not open in Sequencer */
+	UFUNCTION(BlueprintCallable, meta=(DisplayName="Set Active Level Sequence"), Category="VP Stage API|Sequencer")
+	virtual bool SetActiveLevelSequence(ULevelSequence* Sequence) override;
+
 #pragma  endregion
 
 	//Send a Take Recorder Start Message via MultiUser
@@ -523,6 +868,158 @@ public:
 	UFUNCTION(BlueprintCallable, meta=(DisplayName="Take Record Stop via MU"), Category="VP Stage API|Misc")
 	virtual void SendMUMessage_TakeRecordStop() override;
 
+	//Enable and override flags of one grade that the setters switch on, they are not part of the property values
+	struct FGradingOverrideFlags
+	{
+		bool bEnableGrading = false;
+		bool bEnableInnerFrustumGrading = false;
+		bool bExposureOverride = false;
+		//Saturation/Contrast/Gamma/Gain/Offset override bits of the Global, Shadows, Midtones and Highlights bands
+		uint32 BandOverrides = 0;
+
+		bool operator==(const FGradingOverrideFlags& Other) const
+		{
+			return bEnableGrading == Other.bEnableGrading && bEnableInnerFrustumGrading == Other.bEnableInnerFrustumGrading
+				&& bExposureOverride == Other.bExposureOverride && BandOverrides == Other.BandOverrides;
+		}
+	};
+
+	//Override flags of a root's cluster grade and its two ICVFX cameras
+	struct FStageOverrideFlags
+	{
+		TWeakObjectPtr<ADisplayClusterRootActor> Root;
+		FGradingOverrideFlags Cluster;
+		TWeakObjectPtr<UDisplayClusterICVFXCameraComponent> Cameras[2];
+		FGradingOverrideFlags CameraFlags[2];
+
+		bool operator==(const FStageOverrideFlags& Other) const
+		{
+			return Root == Other.Root && Cluster == Other.Cluster && Cameras[0] == Other.Cameras[0] && Cameras[1] == Other.Cameras[1]
+				&& CameraFlags[0] == Other.CameraFlags[0] && CameraFlags[1] == Other.CameraFlags[1];
+		}
+		bool operator!=(const FStageOverrideFlags& Other) const { return !(*this == Other); }
+	};
+
+	//Stage values captured by CapturePreset. Bit N of PropertyMask marks Values[N] as part of the preset
+	struct FStagePreset
+	{
+		uint64 PropertyMask = 0;
+		FVector4 Values[static_cast<uint8>(EStageAPIProperty::Count)];
+		FStageAPIColorGrading ClusterColorGrading;
+		FStageAPIColorGrading FrustumColorGrading;
+		TArray<TPair<FString, FStageAPIViewportRenderSettings>> Viewports;
+		//The values alone would recall with every override the setters touch forced on. Not in version 1 files
+		FGradingOverrideFlags ClusterFlags;
+		FGradingOverrideFlags CameraFlags[2];
+		bool bHasOverrideFlags = false;
+	};
+
 private:
-	
+
+	//Flags of the target root. Restoring writes them back as they were, without going through the forcing setters
+	FStageOverrideFlags CaptureOverrideFlags() const;
+	void RestoreOverrideFlags(const FStageOverrideFlags& Flags);
+
+	//Stores the value in the pending slot when coalescing/interaction is active. Returns false if the setter should run now
+	bool TryCoalesceWrite(EStageAPIProperty Property, const FVector4& Value);
+
+	//Applies every pending value, either in one batch transaction or locally with transactions suppressed
+	void ApplyPendingWrites(bool bLocalOnly);
+
+	bool TickPendingWrites(float DeltaTime);
+	void UpdatePendingWritesTicker();
+
+	//Latest value per property waiting for the next flush
+	FVector4 PendingWriteValues[static_cast<uint8>(EStageAPIProperty::Count)];
+	bool bPendingWrite[static_cast<uint8>(EStageAPIProperty::Count)] = {};
+	int32 NumPendingWrites = 0;
+
+	//Values captured on the first write of an interaction, restored before the final values are committed
+	TMap<EStageAPIProperty, FVector4> InteractionOriginalValues;
+	FStageOverrideFlags InteractionOriginalFlags;
+	int32 InteractionDepth = 0;
+
+	bool bWriteCoalescing = false;
+	bool bFlushingWrites = false;
+	float WriteFlushRate = 0;
+	FTSTicker::FDelegateHandle PendingWritesTickerHandle;
+
+	//Applies a property to each root as one batch
+	void SetPropertyValueOnRoots(const TArray<TWeakObjectPtr<ADisplayClusterRootActor>>& Roots, EStageAPIProperty Property, const FVector4& Value);
+
+	//Viewports a render tier applies to, matched once per topology generation
+	struct FResolvedRenderTier
+	{
+		TArray<TPair<int32, FStageAPIViewportRenderSettings>> Viewports;
+		uint32 TopologyGeneration = 0;
+		bool bValid = false;
+	};
+
+	const FResolvedRenderTier* ResolveRenderTier(FName TierName, const FStageTopology& Topology);
+
+	TMap<FName, FStageAPIRenderTier> RenderTiers;
+	TMap<FName, FResolvedRenderTier> ResolvedRenderTiers;
+	FName ActiveRenderTier;
+
+	//Frustum part of the stage state for an already resolved camera
+	FStageAPIFrustumState GetFrustumState_ByComponent(UDisplayClusterICVFXCameraComponent* IcvfxComponent) const;
+
+	TMap<FName, FStagePreset> StagePresets;
+
+	struct FTransition
+	{
+		EStageAPIProperty Property = EStageAPIProperty::None;
+		//Value and flags before the first transition on the property, restored locally before the end value is committed
+		FVector4 OriginalValue;
+		FStageOverrideFlags OriginalFlags;
+		FVector4 StartValue;
+		FVector4 TargetValue;
+		double StartTime = 0.0;
+		float Duration = 0.0f;
+		TEnumAsByte<EEasingFunc::Type> Easing = EEasingFunc::Linear;
+		float BlendExp = 2.0f;
+		int32 Steps = 2;
+	};
+
+	bool TickTransitions(float DeltaTime);
+	//Commits the transitions in one transaction, at the target values or where they are now
+	void FinishTransitions(TArrayView<const FTransition> FinishedTransitions, bool bJumpToEnd);
+
+	TArray<FTransition> Transitions;
+	FTSTicker::FDelegateHandle TransitionsTickerHandle;
+
+	//Restores the preview snapshot and, when committing, re-applies the net change in one transaction
+	void EndPreviewSession(bool bCommit);
+
+	//Stage state of one root captured by BeginPreviewSession
+	struct FPreviewSnapshot
+	{
+		FVector4 Values[static_cast<uint8>(EStageAPIProperty::Count)];
+		FStageAPIColorGrading ClusterGrading;
+		FStageAPIColorGrading FrustumGrading;
+		FStageOverrideFlags Flags;
+	};
+
+	//Change a session made to one root, filled by EndPreviewSession
+	struct FPreviewChange
+	{
+		TWeakObjectPtr<ADisplayClusterRootActor> Root;
+		TArray<TPair<EStageAPIProperty, FVector4>, TInlineAllocator<16>> Values;
+		FStageAPIColorGrading ClusterGrading;
+		FStageAPIColorGrading FrustumGrading;
+		FStageOverrideFlags Flags;
+		bool bClusterGradingChanged = false;
+		bool bFrustumGradingChanged = false;
+		bool bFlagsChanged = false;
+
+		bool HasChanges() const { return Values.Num() > 0 || bClusterGradingChanged || bFrustumGradingChanged || bFlagsChanged; }
+	};
+
+	//Snapshot of the target root, and putting it back locally. Returns what the session changed on that root
+	FPreviewSnapshot CapturePreviewSnapshot() const;
+	FPreviewChange RestorePreviewSnapshot(const FPreviewSnapshot& Snapshot);
+
+	//Every root in the level is captured, so writes through PushTargetRoot or the bulk calls are part of the session
+	TMap<TWeakObjectPtr<ADisplayClusterRootActor>, FPreviewSnapshot> PreviewSnapshots;
+	bool bPreviewSessionActive = false;
 };
\ No newline at end of file
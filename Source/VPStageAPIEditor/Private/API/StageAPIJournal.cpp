@@ -0,0 +1,499 @@
+#include "StageAPIJournal.h"
+#include "VPStageAPIEditorModule.h"
+#include "StageAPIBlueprintFunctionLibrary.h"
+#include "API/IStageAPIEditor.h"
+#include "Containers/Ticker.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/EngineVersion.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/ObjectAndNameAsStringProxyArchive.h"
+
+#if PLATFORM_WINDOWS
+#include "Windows/AllowWindowsPlatformTypes.h"
+#include "Windows/WindowsHWrapper.h"
+#include "Windows/HideWindowsPlatformTypes.h"
+#endif
+
+static constexpr uint32 JournalMagic = 0x4A535056; // "VPSJ"
+static constexpr uint32 JournalVersion = 1;
+//Payload size + timestamp
+static constexpr int32 JournalRecordHeaderSize = sizeof(uint32) + sizeof(double);
+
+bool FStageAPIJournal::bRecording = false;
+thread_local int32 FStageAPIJournalScope::Depth = 0;
+
+/**
+ * Append-only journal file. Windows maps the file and grows the mapping by doubling, the file is truncated to the
+ * written size when closed. Elsewhere writes go through a buffered file handle.
+ */
+class FStageAPIJournalFile
+{
+public:
+
+	~FStageAPIJournalFile()
+	{
+		Close();
+	}
+
+	bool Open(const FString& Path)
+	{
+		IFileManager::Get().MakeDirectory(*FPaths::GetPath(Path), true);
+		Size = 0;
+
+#if PLATFORM_WINDOWS
+		FileHandle = CreateFileW(*Path, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (FileHandle == INVALID_HANDLE_VALUE)
+			return false;
+
+		return MapView(InitialCapacity);
+#else
+		FileHandle.Reset(FPlatformFileManager::Get().GetPlatformFile().OpenWrite(*Path));
+		Buffer.Reserve(BufferSize);
+		return FileHandle.IsValid();
+#endif
+	}
+
+	void Append(const void* Data, int32 DataSize)
+	{
+#if PLATFORM_WINDOWS
+		if (!View)
+			return;
+
+		if (Size + DataSize > Capacity && !MapView(FMath::Max(Capacity * 2, Size + DataSize)))
+		{
+			UE_LOG(StageAPIEditor, Error, TEXT("VP Stage API journal could not grow its mapping, recording stopped"));
+			return;
+		}
+
+		FMemory::Memcpy(View + Size, Data, DataSize);
+#else
+		if (!FileHandle.IsValid())
+			return;
+
+		Buffer.Append(static_cast<const uint8*>(Data), DataSize);
+		if (Buffer.Num() >= BufferSize)
+		{
+			Flush();
+		}
+#endif
+		Size += DataSize;
+	}
+
+	//Mapped pages reach the disk without help, only the buffered path needs flushing
+	void Flush()
+	{
+#if !PLATFORM_WINDOWS
+		if (FileHandle.IsValid() && Buffer.Num() > 0)
+		{
+			FileHandle->Write(Buffer.GetData(), Buffer.Num());
+			FileHandle->Flush();
+			Buffer.Reset();
+		}
+#endif
+	}
+
+	void Close()
+	{
+#if PLATFORM_WINDOWS
+		UnmapView();
+		if (FileHandle != INVALID_HANDLE_VALUE)
+		{
+			LARGE_INTEGER FileSize;
+			FileSize.QuadPart = static_cast<LONGLONG>(Size);
+			SetFilePointerEx(FileHandle, FileSize, nullptr, FILE_BEGIN);
+			SetEndOfFile(FileHandle);
+			CloseHandle(FileHandle);
+			FileHandle = INVALID_HANDLE_VALUE;
+		}
+#else
+		Flush();
+		FileHandle.Reset();
+#endif
+	}
+
+private:
+
+#if PLATFORM_WINDOWS
+	static constexpr uint64 InitialCapacity = 4 * 1024 * 1024;
+
+	bool MapView(uint64 NewCapacity)
+	{
+		UnmapView();
+
+		//Mapping past the end of the file extends it
+		MappingHandle = CreateFileMappingW(FileHandle, nullptr, PAGE_READWRITE, static_cast<DWORD>(NewCapacity >> 32), static_cast<DWORD>(NewCapacity & 0xFFFFFFFF), nullptr);
+		if (!MappingHandle)
+			return false;
+
+		View = static_cast<uint8*>(MapViewOfFile(MappingHandle, FILE_MAP_WRITE, 0, 0, static_cast<SIZE_T>(NewCapacity)));
+		if (!View)
+		{
+			CloseHandle(MappingHandle);
+			MappingHandle = nullptr;
+			return false;
+		}
+
+		Capacity = NewCapacity;
+		return true;
+	}
+
+	void UnmapView()
+	{
+		if (View)
+		{
+			FlushViewOfFile(View, static_cast<SIZE_T>(Size));
+			UnmapViewOfFile(View);
+			View = nullptr;
+		}
+		if (MappingHandle)
+		{
+			CloseHandle(MappingHandle);
+			MappingHandle = nullptr;
+		}
+		Capacity = 0;
+	}
+
+	HANDLE FileHandle = INVALID_HANDLE_VALUE;
+	HANDLE MappingHandle = nullptr;
+	uint8* View = nullptr;
+	uint64 Capacity = 0;
+#else
+	static constexpr int32 BufferSize = 64 * 1024;
+
+	TUniquePtr<IFileHandle> FileHandle;
+	TArray<uint8> Buffer;
+#endif
+
+	uint64 Size = 0;
+};
+
+struct FStageAPIJournalReplayRecord
+{
+	double Time = 0.0;
+	int32 Offset = 0;
+	int32 Size = 0;
+};
+
+static TUniquePtr<FStageAPIJournalFile> s_JournalFile;
+static double s_JournalStartSeconds = 0.0;
+static TArray<uint8> s_JournalScratch;
+static FTSTicker::FDelegateHandle s_JournalFlushTickerHandle;
+
+static TArray<uint8> s_ReplayData;
+static TArray<FStageAPIJournalReplayRecord> s_ReplayRecords;
+static int32 s_ReplayNext = 0;
+static double s_ReplayStartSeconds = 0.0;
+static float s_ReplayRate = 1.0f;
+static int32 s_ReplayFailures = 0;
+static FTSTicker::FDelegateHandle s_ReplayTickerHandle;
+
+#pragma region "Recording"
+
+bool FStageAPIJournal::StartRecording(const FString& Path)
+{
+	StopRecording();
+
+	s_JournalFile = MakeUnique<FStageAPIJournalFile>();
+	if (!s_JournalFile->Open(Path))
+	{
+		UE_LOG(StageAPIEditor, Error, TEXT("VP Stage API journal could not open %s"), *Path);
+		s_JournalFile.Reset();
+		return false;
+	}
+
+	uint32 Magic = JournalMagic;
+	uint32 Version = JournalVersion;
+	int64 StartTicks = FDateTime::UtcNow().GetTicks();
+	uint32 Changelist = FEngineVersion::Current().GetChangelist();
+
+	s_JournalScratch.Reset();
+	FMemoryWriter Writer(s_JournalScratch);
+	Writer << Magic << Version << StartTicks << Changelist;
+	s_JournalFile->Append(s_JournalScratch.GetData(), s_JournalScratch.Num());
+
+	s_JournalStartSeconds = FPlatformTime::Seconds();
+	s_JournalFlushTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([](float)
+	{
+		s_JournalFile->Flush();
+		return true;
+	}));
+
+	bRecording = true;
+	UE_LOG(StageAPIEditor, Log, TEXT("VP Stage API journal recording to %s"), *Path);
+	return true;
+}
+
+void FStageAPIJournal::StopRecording()
+{
+	if (!bRecording)
+		return;
+
+	bRecording = false;
+	FTSTicker::GetCoreTicker().RemoveTicker(s_JournalFlushTickerHandle);
+	s_JournalFlushTickerHandle.Reset();
+	s_JournalFile.Reset();
+	s_JournalScratch.Empty();
+}
+
+void FStageAPIJournal::WriteRecord(const UFunction* Function, void* Params)
+{
+	s_JournalScratch.Reset();
+	FMemoryWriter Writer(s_JournalScratch);
+
+	uint32 PayloadSize = 0;
+	double Time = FPlatformTime::Seconds() - s_JournalStartSeconds;
+	Writer << PayloadSize << Time;
+
+	FObjectAndNameAsStringProxyArchive Proxy(Writer, false);
+	FName FunctionName = Function->GetFName();
+	Proxy << FunctionName;
+	if (Params)
+	{
+		Function->SerializeBin(Proxy, Params);
+	}
+
+	PayloadSize = s_JournalScratch.Num() - JournalRecordHeaderSize;
+	FMemory::Memcpy(s_JournalScratch.GetData(), &PayloadSize, sizeof(PayloadSize));
+	s_JournalFile->Append(s_JournalScratch.GetData(), s_JournalScratch.Num());
+}
+
+void FStageAPIJournal::LogArgumentMismatch(const TCHAR* FunctionName)
+{
+	UE_LOG(StageAPIEditor, Warning, TEXT("VP Stage API journal: arguments of %s do not match its parameters, call not recorded"), FunctionName);
+}
+
+#pragma endregion
+
+#pragma region "Replay"
+
+//Runs one record through ProcessEvent. Returns false if the function is gone or the parameters do not load
+static bool s_ReplayRecord(UObject* API, const FStageAPIJournalReplayRecord& Record)
+{
+	FMemoryReader Reader(s_ReplayData);
+	Reader.Seek(Record.Offset);
+	FObjectAndNameAsStringProxyArchive Proxy(Reader, true);
+
+	//A string can not be longer than its record, a corrupt length fails the load instead of allocating it
+	Reader.ArMaxSerializeSize = Record.Size;
+	Proxy.ArMaxSerializeSize = Record.Size;
+
+	FName FunctionName;
+	Proxy << FunctionName;
+	UFunction* Function = API->FindFunction(FunctionName);
+	if (!Function || Reader.IsError())
+		return false;
+
+	uint8* Params = Function->ParmsSize > 0 ? static_cast<uint8*>(FMemory::Malloc(Function->ParmsSize, Function->GetMinAlignment())) : nullptr;
+	if (Params)
+	{
+		Function->InitializeStruct(Params);
+		Function->SerializeBin(Proxy, Params);
+	}
+
+	bool const bLoaded = !Reader.IsError() && Reader.Tell() <= Record.Offset + Record.Size;
+	if (bLoaded)
+	{
+		API->ProcessEvent(Function, Params);
+	}
+
+	if (Params)
+	{
+		Function->DestroyStruct(Params);
+		FMemory::Free(Params);
+	}
+	return bLoaded;
+}
+
+static UObject* s_GetReplayAPI()
+{
+	TScriptInterface<IStageAPIEditor> ScriptAPI;
+	UStageAPIBlueprintFunctionLibrary::GetAPI(ScriptAPI);
+	return ScriptAPI.GetObject();
+}
+
+static void s_FinishReplay()
+{
+	UE_LOG(StageAPIEditor, Log, TEXT("VP Stage API journal replay finished, %d of %d calls replayed, %d failed"), s_ReplayNext, s_ReplayRecords.Num(), s_ReplayFailures);
+
+	FTSTicker::GetCoreTicker().RemoveTicker(s_ReplayTickerHandle);
+	s_ReplayTickerHandle.Reset();
+	s_ReplayData.Empty();
+	s_ReplayRecords.Empty();
+}
+
+static bool s_TickReplay(float DeltaTime)
+{
+	UObject* API = s_GetReplayAPI();
+	if (!API)
+	{
+		s_FinishReplay();
+		return true;
+	}
+
+	double const Elapsed = (FPlatformTime::Seconds() - s_ReplayStartSeconds) * s_ReplayRate;
+
+	//Calls made by the replay count as nested, so a journal being recorded at the same time does not capture them
+	FStageAPIJournalScope JournalScope;
+	while (s_ReplayNext < s_ReplayRecords.Num() && s_ReplayRecords[s_ReplayNext].Time <= Elapsed)
+	{
+		s_ReplayFailures += s_ReplayRecord(API, s_ReplayRecords[s_ReplayNext]) ? 0 : 1;
+		++s_ReplayNext;
+	}
+
+	if (s_ReplayNext >= s_ReplayRecords.Num())
+	{
+		s_FinishReplay();
+	}
+	return true;
+}
+
+bool FStageAPIJournal::StartReplay(const FString& Path, float Rate)
+{
+	StopReplay();
+
+	if (!FFileHelper::LoadFileToArray(s_ReplayData, *Path))
+	{
+		UE_LOG(StageAPIEditor, Error, TEXT("VP Stage API journal could not read %s"), *Path);
+		return false;
+	}
+
+	FMemoryReader Reader(s_ReplayData);
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	int64 StartTicks = 0;
+	uint32 Changelist = 0;
+	Reader << Magic << Version << StartTicks << Changelist;
+	if (Reader.IsError() || Magic != JournalMagic || Version != JournalVersion)
+	{
+		UE_LOG(StageAPIEditor, Error, TEXT("VP Stage API journal: %s is not a version %d journal"), *Path, JournalVersion);
+		s_ReplayData.Empty();
+		return false;
+	}
+
+	if (Changelist != FEngineVersion::Current().GetChangelist())
+	{
+		UE_LOG(StageAPIEditor, Warning, TEXT("VP Stage API journal was recorded with changelist %u, parameters may not load"), Changelist);
+	}
+
+	//Index the records up front, a mapped file that was not closed ends in zeros
+	s_ReplayRecords.Reset();
+	while (s_ReplayData.Num() - Reader.Tell() >= JournalRecordHeaderSize)
+	{
+		FStageAPIJournalReplayRecord Record;
+		uint32 PayloadSize = 0;
+		Reader << PayloadSize << Record.Time;
+		if (PayloadSize == 0 || PayloadSize > static_cast<uint32>(s_ReplayData.Num() - Reader.Tell()))
+			break;
+
+		Record.Offset = static_cast<int32>(Reader.Tell());
+		Record.Size = static_cast<int32>(PayloadSize);
+		s_ReplayRecords.Add(Record);
+		Reader.Seek(Record.Offset + Record.Size);
+	}
+
+	s_ReplayNext = 0;
+	s_ReplayFailures = 0;
+
+	UObject* API = s_GetReplayAPI();
+	if (!API)
+	{
+		s_ReplayData.Empty();
+		s_ReplayRecords.Empty();
+		return false;
+	}
+
+	UE_LOG(StageAPIEditor, Log, TEXT("VP Stage API journal replaying %d calls from %s recorded %s"), s_ReplayRecords.Num(), *Path, *FDateTime(StartTicks).ToString());
+
+	if (Rate <= 0.0f)
+	{
+		FStageAPIJournalScope JournalScope;
+		double const StartSeconds = FPlatformTime::Seconds();
+		for (; s_ReplayNext < s_ReplayRecords.Num(); ++s_ReplayNext)
+		{
+			s_ReplayFailures += s_ReplayRecord(API, s_ReplayRecords[s_ReplayNext]) ? 0 : 1;
+		}
+		double const Seconds = FPlatformTime::Seconds() - StartSeconds;
+
+		UE_LOG(StageAPIEditor, Log, TEXT("VP Stage API journal replayed %d calls in %.3f ms, %.0f calls/s"), s_ReplayRecords.Num(), Seconds * 1000.0, Seconds > 0.0 ? s_ReplayRecords.Num() / Seconds : 0.0);
+		s_FinishReplay();
+		return true;
+	}
+
+	s_ReplayRate = Rate;
+	s_ReplayStartSeconds = FPlatformTime::Seconds();
+	s_ReplayTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateStatic(&s_TickReplay));
+	return true;
+}
+
+void FStageAPIJournal::StopReplay()
+{
+	if (IsReplaying())
+	{
+		s_FinishReplay();
+	}
+}
+
+bool FStageAPIJournal::IsReplaying()
+{
+	return s_ReplayTickerHandle.IsValid();
+}
+
+#pragma endregion
+
+#pragma region "Console Commands"
+
+//StageAPI.Journal.Start [File=<path>]
+static FAutoConsoleCommand StageAPIJournalStartCommand(
+	TEXT("StageAPI.Journal.Start"),
+	TEXT("Records every Stage API call to a journal file. Args: File= (default Saved/VPStageAPI/Journal/<date>.vpsj)"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		FString const CommandLine = FString::Join(Args, TEXT(" "));
+		FString Path = FPaths::ProjectSavedDir() / TEXT("VPStageAPI/Journal") / (FDateTime::Now().ToString() + TEXT(".vpsj"));
+		FParse::Value(*CommandLine, TEXT("File="), Path);
+		FStageAPIJournal::StartRecording(Path);
+	}));
+
+static FAutoConsoleCommand StageAPIJournalStopCommand(
+	TEXT("StageAPI.Journal.Stop"),
+	TEXT("Stops recording the Stage API journal"),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		FStageAPIJournal::StopRecording();
+	}));
+
+//StageAPI.Journal.Replay File=<path> [Rate=1] [Fast]
+static FAutoConsoleCommand StageAPIJournalReplayCommand(
+	TEXT("StageAPI.Journal.Replay"),
+	TEXT("Replays a Stage API journal. Args: File= Rate= (speed multiplier, default 1) Fast (every call immediately, reports throughput)"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		FString const CommandLine = FString::Join(Args, TEXT(" "));
+		FString Path;
+		float Rate = 1.0f;
+		if (!FParse::Value(*CommandLine, TEXT("File="), Path))
+		{
+			UE_LOG(StageAPIEditor, Warning, TEXT("Usage: StageAPI.Journal.Replay File=<path> [Rate=1] [Fast]"));
+			return;
+		}
+		FParse::Value(*CommandLine, TEXT("Rate="), Rate);
+		if (Args.Contains(TEXT("Fast")))
+		{
+			Rate = 0.0f;
+		}
+		FStageAPIJournal::StartReplay(Path, Rate);
+	}));
+
+static FAutoConsoleCommand StageAPIJournalStopReplayCommand(
+	TEXT("StageAPI.Journal.StopReplay"),
+	TEXT("Stops a Stage API journal replay"),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		FStageAPIJournal::StopReplay();
+	}));
+
+#pragma endregion
@@ -0,0 +1,188 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Class.h"
+#include "UObject/UnrealType.h"
+#include "UObject/EnumProperty.h"
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+// API JOURNAL
+//
+//Appends every outermost API call made on the game thread, with its arguments and a timestamp, to a binary file.
+//Calls the API makes on itself (RecallPreset setting properties, flushing coalesced writes, transition frames) are
+//not recorded, replaying the outer call reproduces them. On Windows the file is memory mapped, so records written
+//before a crash are still on disk. Other platforms use a buffered file handle flushed every frame.
+//
+//File layout, native byte order:
+//	Header	uint32 Magic 'VPSJ', uint32 Version, int64 UTC start ticks, uint32 Engine changelist
+//	Record	uint32 Payload size, double Seconds since start, payload
+//	Payload	function name, then the function's parameter block serialized through its reflection data. Object
+//			parameters are stored as paths
+//A zero payload size marks the end of a mapped file that was not closed.
+//
+//StageAPI.Journal.Start [File=<path>]				Starts recording, default Saved/VPStageAPI/Journal/<date>.vpsj
+//StageAPI.Journal.Stop
+//StageAPI.Journal.Replay File=<path> [Rate=1] [Fast]	Plays a journal back through UFunction reflection, at Rate times the
+//													original speed or, with Fast, in one go as fast as possible
+//StageAPI.Journal.StopReplay
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+class FStageAPIJournal
+{
+public:
+
+	static bool StartRecording(const FString& Path);
+	static void StopRecording();
+	static bool IsRecording() { return bRecording; }
+
+	//Rate scales the original timing, a Rate of 0 or less replays every call immediately and reports throughput
+	static bool StartReplay(const FString& Path, float Rate);
+	static void StopReplay();
+	static bool IsReplaying();
+
+	/**
+	 * Copies the arguments into a parameter block laid out by the API function's reflection data and appends it.
+	 * Arguments are the function's input parameters in declaration order.
+	 */
+	template<typename... ArgTypes>
+	static void Record(const UObject* API, const TCHAR* FunctionName, const ArgTypes&... Args)
+	{
+		const UFunction* Function = API->FindFunction(FName(FunctionName));
+		if (!Function)
+			return;
+
+		uint8* Params = Function->ParmsSize > 0 ? static_cast<uint8*>(FMemory_Alloca_Aligned(Function->ParmsSize, Function->GetMinAlignment())) : nullptr;
+		if (Params)
+		{
+			Function->InitializeStruct(Params);
+		}
+
+		TFieldIterator<FProperty> ParamIt(Function);
+		bool bMatched = true;
+		(CopyParam(ParamIt, Params, Args, bMatched), ...);
+
+		if (bMatched)
+		{
+			WriteRecord(Function, Params);
+		}
+		else
+		{
+			LogArgumentMismatch(FunctionName);
+		}
+
+		if (Params)
+		{
+			Function->DestroyStruct(Params);
+		}
+	}
+
+private:
+
+	static bool IsInputParam(const FProperty* Property)
+	{
+		return Property->HasAnyPropertyFlags(CPF_Parm)
+			&& !Property->HasAnyPropertyFlags(CPF_ReturnParm)
+			&& (!Property->HasAnyPropertyFlags(CPF_OutParm) || Property->HasAnyPropertyFlags(CPF_ConstParm));
+	}
+
+	//Whether a parameter's property holds values of the argument's type. The pointer only selects the overload
+	static bool IsParamOfType(const FProperty* Property, const bool*) { return Property->IsA<FBoolProperty>(); }
+	static bool IsParamOfType(const FProperty* Property, const int32*) { return Property->IsA<FIntProperty>(); }
+	static bool IsParamOfType(const FProperty* Property, const float*) { return Property->IsA<FFloatProperty>(); }
+	static bool IsParamOfType(const FProperty* Property, const FString*) { return Property->IsA<FStrProperty>(); }
+	static bool IsParamOfType(const FProperty* Property, const FName*) { return Property->IsA<FNameProperty>(); }
+
+	template<typename EnumType>
+	static bool IsParamOfType(const FProperty* Property, const TEnumAsByte<EnumType>*)
+	{
+		const FByteProperty* ByteProperty = CastField<FByteProperty>(Property);
+		return ByteProperty && ByteProperty->Enum == StaticEnum<EnumType>();
+	}
+
+	template<typename ElementType>
+	static bool IsParamOfType(const FProperty* Property, const TArray<ElementType>*)
+	{
+		const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property);
+		return ArrayProperty && IsParamOfType(ArrayProperty->Inner, static_cast<const ElementType*>(nullptr));
+	}
+
+	template<typename ObjectType>
+	static bool IsParamOfType(const FProperty* Property, ObjectType* const*)
+	{
+		const FObjectPropertyBase* ObjectProperty = CastField<FObjectPropertyBase>(Property);
+		return ObjectProperty && ObjectProperty->PropertyClass && ObjectType::StaticClass()->IsChildOf(ObjectProperty->PropertyClass);
+	}
+
+	//UENUM enum classes
+	template<typename ArgType>
+	static typename TEnableIf<TIsEnum<ArgType>::Value, bool>::Type IsParamOfType(const FProperty* Property, const ArgType*)
+	{
+		const FEnumProperty* EnumProperty = CastField<FEnumProperty>(Property);
+		return EnumProperty && EnumProperty->GetEnum() == StaticEnum<ArgType>();
+	}
+
+	//USTRUCTs and the core structs with a TBaseStructure
+	template<typename ArgType>
+	static typename TEnableIf<TIsClass<ArgType>::Value, bool>::Type IsParamOfType(const FProperty* Property, const ArgType*)
+	{
+		const FStructProperty* StructProperty = CastField<FStructProperty>(Property);
+		return StructProperty && StructProperty->Struct == TBaseStructure<ArgType>::Get();
+	}
+
+	template<typename ArgType>
+	static void CopyParam(TFieldIterator<FProperty>& ParamIt, uint8* Params, const ArgType& Arg, bool& bMatched)
+	{
+		while (ParamIt && !IsInputParam(*ParamIt))
+		{
+			++ParamIt;
+		}
+
+		if (!ParamIt || !IsParamOfType(*ParamIt, &Arg) || ParamIt->GetSize() != sizeof(ArgType))
+		{
+			bMatched = false;
+			return;
+		}
+
+		ParamIt->CopySingleValue(ParamIt->ContainerPtrToValuePtr<void>(Params), &Arg);
+		++ParamIt;
+	}
+
+	static void WriteRecord(const UFunction* Function, void* Params);
+	static void LogArgumentMismatch(const TCHAR* FunctionName);
+
+	static bool bRecording;
+};
+
+/**
+ * Tracks API call nesting so only the outermost call is journaled. Internal tickers that drive the API hold one
+ * as well, so their calls are treated as nested.
+ */
+struct FStageAPIJournalScope
+{
+	FStageAPIJournalScope()
+		: bOutermost(Depth++ == 0)
+	{
+	}
+
+	~FStageAPIJournalScope()
+	{
+		--Depth;
+	}
+
+	bool ShouldRecord() const
+	{
+		return bOutermost && FStageAPIJournal::IsRecording() && IsInGameThread();
+	}
+
+	bool bOutermost;
+
+	static thread_local int32 Depth;
+};
+
+//Journals the enclosing API function. Follows STAGEAPI_TRACE, arguments are the function's parameters in order
+#define STAGEAPI_JOURNAL(Name, ...) \
+	FStageAPIJournalScope StageAPIJournalScope; \
+	if (UNLIKELY(StageAPIJournalScope.ShouldRecord())) \
+	{ \
+		FStageAPIJournal::Record(this, TEXT(#Name), ##__VA_ARGS__); \
+	}
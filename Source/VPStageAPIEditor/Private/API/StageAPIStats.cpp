@@ -0,0 +1,92 @@
+#include "StageAPIStats.h"
+#include "API/StageAPITypes.h"
+
+static std::atomic<FStageAPILatencyHistogram*> s_FirstLatencyHistogram{ nullptr };
+
+FStageAPILatencyHistogram::FStageAPILatencyHistogram(const TCHAR* InName)
+	: Name(InName)
+	, Count(0)
+	, MaxCycles(0)
+{
+	for (std::atomic<uint32>& Bucket : Buckets)
+	{
+		Bucket.store(0, std::memory_order_relaxed);
+	}
+
+	//Lock-free push, histograms are never removed
+	Next = s_FirstLatencyHistogram.load(std::memory_order_relaxed);
+	while (!s_FirstLatencyHistogram.compare_exchange_weak(Next, this, std::memory_order_release, std::memory_order_relaxed))
+	{
+	}
+}
+
+FStageAPILatencyHistogram* FStageAPILatencyHistogram::GetFirst()
+{
+	return s_FirstLatencyHistogram.load(std::memory_order_acquire);
+}
+
+double FStageAPILatencyHistogram::GetBucketCycles(int32 BucketIndex)
+{
+	if (BucketIndex < static_cast<int32>(SubBuckets))
+		return BucketIndex;
+
+	uint32 const Log = BucketIndex / SubBuckets + SubBucketBits - 1;
+	uint32 const SubBucket = BucketIndex % SubBuckets;
+	double const BucketWidth = static_cast<double>(1ull << (Log - SubBucketBits));
+	return (SubBuckets + SubBucket) * BucketWidth + BucketWidth * 0.5;
+}
+
+void FStageAPILatencyHistogram::Reset()
+{
+	//Calls recording while this runs may survive the reset, that is fine for a dashboard
+	for (std::atomic<uint32>& Bucket : Buckets)
+	{
+		Bucket.store(0, std::memory_order_relaxed);
+	}
+	Count.store(0, std::memory_order_relaxed);
+	MaxCycles.store(0, std::memory_order_relaxed);
+}
+
+FStageAPILatencyStats FStageAPILatencyHistogram::GetStats() const
+{
+	FStageAPILatencyStats Stats;
+	Stats.FunctionName = Name;
+
+	//Snapshot first so the percentiles are computed against a consistent total
+	uint32 Snapshot[NumBuckets];
+	uint64 Total = 0;
+	for (int32 BucketIdx = 0; BucketIdx < NumBuckets; ++BucketIdx)
+	{
+		Snapshot[BucketIdx] = Buckets[BucketIdx].load(std::memory_order_relaxed);
+		Total += Snapshot[BucketIdx];
+	}
+
+	Stats.Calls = static_cast<int64>(Total);
+	if (Total == 0)
+		return Stats;
+
+	double const MicrosecondsPerCycle = FPlatformTime::GetSecondsPerCycle64() * 1.e6;
+	double const MaxUs = MaxCycles.load(std::memory_order_relaxed) * MicrosecondsPerCycle;
+
+	auto GetPercentileUs = [&](double Percentile)
+	{
+		uint64 const TargetRank = FMath::Max<uint64>(1, static_cast<uint64>(FMath::CeilToDouble(Percentile * Total)));
+		uint64 Cumulative = 0;
+		for (int32 BucketIdx = 0; BucketIdx < NumBuckets; ++BucketIdx)
+		{
+			Cumulative += Snapshot[BucketIdx];
+			if (Cumulative >= TargetRank)
+			{
+				//The bucket middle can overshoot the largest recorded call
+				return static_cast<float>(FMath::Min(GetBucketCycles(BucketIdx) * MicrosecondsPerCycle, MaxUs));
+			}
+		}
+		return static_cast<float>(MaxUs);
+	};
+
+	Stats.P50Us = GetPercentileUs(0.50);
+	Stats.P95Us = GetPercentileUs(0.95);
+	Stats.P99Us = GetPercentileUs(0.99);
+	Stats.MaxUs = static_cast<float>(MaxUs);
+	return Stats;
+}
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include <atomic>
+
+struct FStageAPILatencyStats;
+
+DECLARE_STATS_GROUP(TEXT("VP Stage API"), STATGROUP_StageAPI, STATCAT_Advanced);
+
+/**
+ * Call duration histogram of a single API function. Buckets are log2 scale with 4 sub-buckets per octave (about 19%
+ * resolution) over raw CPU cycles, so recording is a handful of relaxed atomic adds and never allocates. Each
+ * histogram is a function local static that links itself into a global lock-free list on first use.
+ */
+struct FStageAPILatencyHistogram
+{
+	static constexpr uint32 SubBucketBits = 2;
+	static constexpr uint32 SubBuckets = 1 << SubBucketBits;
+	static constexpr int32 NumBuckets = (64 - SubBucketBits + 1) * SubBuckets;
+
+	explicit FStageAPILatencyHistogram(const TCHAR* InName);
+
+	void Record(uint64 Cycles)
+	{
+		Buckets[GetBucketIndex(Cycles)].fetch_add(1, std::memory_order_relaxed);
+		Count.fetch_add(1, std::memory_order_relaxed);
+
+		uint64 CurrentMax = MaxCycles.load(std::memory_order_relaxed);
+		while (Cycles > CurrentMax && !MaxCycles.compare_exchange_weak(CurrentMax, Cycles, std::memory_order_relaxed))
+		{
+		}
+	}
+
+	static int32 GetBucketIndex(uint64 Cycles)
+	{
+		if (Cycles < SubBuckets)
+			return static_cast<int32>(Cycles);
+
+		uint32 const Log = static_cast<uint32>(FMath::FloorLog2_64(Cycles));
+		uint32 const SubBucket = static_cast<uint32>(Cycles >> (Log - SubBucketBits)) & (SubBuckets - 1);
+		return static_cast<int32>((Log - SubBucketBits + 1) * SubBuckets + SubBucket);
+	}
+
+	//Middle of the cycle range a bucket covers
+	static double GetBucketCycles(int32 BucketIndex);
+
+	void Reset();
+	FStageAPILatencyStats GetStats() const;
+
+	//Every histogram that has been recorded into, newest first
+	static FStageAPILatencyHistogram* GetFirst();
+
+	const TCHAR* Name;
+	FStageAPILatencyHistogram* Next = nullptr;
+
+	std::atomic<uint32> Buckets[NumBuckets];
+	std::atomic<uint64> Count;
+	std::atomic<uint64> MaxCycles;
+};
+
+struct FStageAPILatencyScope
+{
+	explicit FStageAPILatencyScope(FStageAPILatencyHistogram& InHistogram)
+		: Histogram(InHistogram)
+		, StartCycles(FPlatformTime::Cycles64())
+	{
+	}
+
+	~FStageAPILatencyScope()
+	{
+		Histogram.Record(FPlatformTime::Cycles64() - StartCycles);
+	}
+
+	FStageAPILatencyHistogram& Histogram;
+	uint64 StartCycles;
+};
+
+//Scope marker for API entry points and slow paths, shows up in Unreal Insights as "StageAPI_<Name>" and records the
+//call duration in the function's latency histogram. With stats compiled in the cycle counter emits the CPU trace
+//event itself and also feeds "stat StageAPI".
+#if STATS
+	#define STAGEAPI_TRACE_SCOPE(Name) DECLARE_SCOPE_CYCLE_COUNTER(TEXT("StageAPI_" #Name), STAT_StageAPI_##Name, STATGROUP_StageAPI);
+#else
+	#define STAGEAPI_TRACE_SCOPE(Name) TRACE_CPUPROFILER_EVENT_SCOPE(StageAPI_##Name);
+#endif
+
+#define STAGEAPI_TRACE(Name) \
+	STAGEAPI_TRACE_SCOPE(Name) \
+	static FStageAPILatencyHistogram StageAPILatencyHistogram(TEXT(#Name)); \
+	FStageAPILatencyScope StageAPILatencyScope(StageAPILatencyHistogram);
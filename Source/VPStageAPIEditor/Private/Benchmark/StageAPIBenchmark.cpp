@@ -0,0 +1,555 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "CoreMinimal.h"
+#include "VPStageAPIEditorModule.h"
+#include "StageAPIBlueprintFunctionLibrary.h"
+#include "API/IStageAPIEditor.h"
+#include "Editor.h"
+#include "Editor/Transactor.h"
+#include "CineCameraActor.h"
+#include "DisplayClusterRootActor.h"
+#include "DisplayClusterConfigurationTypes.h"
+#include "Components/DisplayClusterICVFXCameraComponent.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformMemory.h"
+#include "Interfaces/IPluginManager.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+// STAGE API BENCHMARK
+//
+//StageAPI.Benchmark [Nodes=4] [ViewportsPerNode=4] [Cameras=2] [Iterations=1000] [Output=<path>] [Baseline=<path>]
+//                   [Threshold=25] [WriteBaseline] [Quit]
+//
+//Spawns a synthetic nDisplay root with the requested cluster layout and ICVFX cameras, makes it the active root and
+//times every getter and setter reached through the generic property access, the typed stage transform, per component
+//and preview calls, the Sequencer calls, root targeting, presets, render tiers and transitions, plus the whole-stage
+//and topology calls. Bulk root calls only reach the synthetic root through its tag, SetPropertyValueOnAllRoots and
+//Multi-User messages are not covered. The run leaves a render tier named StageAPIBenchmark registered and active.
+//Per call it reports mean, p50 and p99 time and the memory retained per call, from process memory stats taken around
+//the measured loop. The allocator is left alone, so the memory figure includes other threads and is only meaningful
+//well above the noise floor. Results go to a JSON file and are compared
+//against the baseline in the plugin's Resources/Benchmark folder, recorded with WriteBaseline on the reference
+//machine. Headless:
+//	UnrealEditor-Cmd <Project> -nullrhi -unattended -ExecCmds="StageAPI.Benchmark Quit"
+//With Quit the editor exits with 1 if a call regressed past the threshold or the baseline is unreadable. Without a
+//baseline file the comparison is skipped with a warning until one has been recorded. The automation test
+//VPStageAPI.Benchmark runs the same benchmark with the default arguments and fails on the same conditions.
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+//Tag, preset and render tier name used by the run
+static const FName StageAPIBenchmarkName(TEXT("StageAPIBenchmark"));
+
+struct FStageAPIBenchmarkCall
+{
+	FString Name;
+	TFunction<void()> Call;
+	//Opens transactions, the undo entries are dropped again after every call
+	bool bTransacted = false;
+};
+
+struct FStageAPIBenchmarkResult
+{
+	FString Name;
+	double MeanUs = 0.0;
+	double P50Us = 0.0;
+	double P99Us = 0.0;
+	//Process memory growth over the measured loop divided by the iterations
+	double BytesPerCall = 0.0;
+};
+
+/**
+ * @brief Spawns a transient nDisplay root with NumNodes x ViewportsPerNode viewports and NumCameras ICVFX cameras,
+ * each driven by its own cine camera actor.
+ */
+static ADisplayClusterRootActor* s_SpawnBenchmarkRoot(UWorld* World, int32 NumNodes, int32 ViewportsPerNode, int32 NumCameras, TArray<AActor*>& OutSpawnedActors)
+{
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.Name = MakeUniqueObjectName(World->GetCurrentLevel(), ADisplayClusterRootActor::StaticClass(), TEXT("StageAPIBenchmarkRoot"));
+	SpawnParams.ObjectFlags = RF_Transient;
+
+	ADisplayClusterRootActor* Root = World->SpawnActor<ADisplayClusterRootActor>(SpawnParams);
+	if (!Root)
+		return nullptr;
+
+	OutSpawnedActors.Add(Root);
+	Root->Tags.Add(StageAPIBenchmarkName);
+
+	UDisplayClusterConfigurationData* ConfigData = Root->GetConfigData();
+	if (!ConfigData)
+	{
+		Root->UpdateConfigDataInstance(NewObject<UDisplayClusterConfigurationData>(GetTransientPackage()), true);
+		ConfigData = Root->GetConfigData();
+	}
+	if (!ConfigData)
+		return Root;
+
+	if (!ConfigData->Cluster)
+	{
+		ConfigData->Cluster = NewObject<UDisplayClusterConfigurationCluster>(ConfigData, NAME_None, RF_Transactional);
+	}
+
+	for (int32 NodeIdx = 0; NodeIdx < NumNodes; ++NodeIdx)
+	{
+		UDisplayClusterConfigurationClusterNode* Node = NewObject<UDisplayClusterConfigurationClusterNode>(ConfigData->Cluster, NAME_None, RF_Transactional);
+		for (int32 ViewportIdx = 0; ViewportIdx < ViewportsPerNode; ++ViewportIdx)
+		{
+			Node->Viewports.Add(FString::Printf(TEXT("VP_%d_%d"), NodeIdx, ViewportIdx), NewObject<UDisplayClusterConfigurationViewport>(Node, NAME_None, RF_Transactional));
+		}
+		ConfigData->Cluster->Nodes.Add(FString::Printf(TEXT("Node_%d"), NodeIdx), Node);
+	}
+
+	for (int32 CameraIdx = 0; CameraIdx < NumCameras; ++CameraIdx)
+	{
+		FActorSpawnParameters CameraSpawnParams;
+		CameraSpawnParams.ObjectFlags = RF_Transient;
+		ACineCameraActor* CameraActor = World->SpawnActor<ACineCameraActor>(CameraSpawnParams);
+		OutSpawnedActors.Add(CameraActor);
+
+		UDisplayClusterICVFXCameraComponent* IcvfxCamera = NewObject<UDisplayClusterICVFXCameraComponent>(Root, *FString::Printf(TEXT("ICVFXCamera_%d"), CameraIdx), RF_Transactional);
+		IcvfxCamera->CameraSettings.ExternalCameraActor = CameraActor;
+		IcvfxCamera->CameraSettings.RenderSettings.RenderOrder = NumCameras - CameraIdx;
+		IcvfxCamera->SetupAttachment(Root->GetRootComponent());
+		IcvfxCamera->RegisterComponent();
+		Root->AddInstanceComponent(IcvfxCamera);
+	}
+
+	return Root;
+}
+
+/**
+ * @brief Every getter and setter reachable through the property access, each setter writing back the current value
+ * so the stage does not drift, followed by the typed stage transform, per component, preview and Sequencer calls
+ * and the calls that have no property. Sequencer calls take their early out unless a sequence is open.
+ */
+static TArray<FStageAPIBenchmarkCall> s_BuildBenchmarkCalls(IStageAPIEditor* API)
+{
+	TArray<FStageAPIBenchmarkCall> Calls;
+	UEnum* PropertyEnum = StaticEnum<EStageAPIProperty>();
+
+	for (EStageAPIProperty Property : TEnumRange<EStageAPIProperty>())
+	{
+		if (Property == EStageAPIProperty::None)
+			continue;
+
+		FString const PropertyName = PropertyEnum->GetNameStringByValue(static_cast<int64>(Property));
+		FVector4 const Value = API->GetPropertyValue(Property);
+
+		Calls.Add({ TEXT("Get") + PropertyName, [API, Property]() { API->GetPropertyValue(Property); } });
+		Calls.Add({ TEXT("Set") + PropertyName, [API, Property, Value]() { API->SetPropertyValue(Property, Value); }, true });
+	}
+
+	FStageAPIColorGrading const ClusterColorGrading = API->GetClusterColorGrading();
+	FStageAPIColorGrading const FrustumColorGrading = API->GetFrustumColorGrading();
+	TArray<FString> const ViewportNames = API->GetViewportNames();
+	FString const FirstViewport = ViewportNames.Num() > 0 ? ViewportNames[0] : FString();
+	FStageAPIViewportRenderSettings const ViewportSettings = API->GetViewportRenderSettings(FirstViewport);
+
+	Calls.Add({ TEXT("GetClusterColorGrading"), [API]() { API->GetClusterColorGrading(); } });
+	Calls.Add({ TEXT("SetClusterColorGrading"), [API, ClusterColorGrading]() { API->SetClusterColorGrading(ClusterColorGrading); }, true });
+	Calls.Add({ TEXT("GetFrustumColorGrading"), [API]() { API->GetFrustumColorGrading(); } });
+	Calls.Add({ TEXT("SetFrustumColorGrading"), [API, FrustumColorGrading]() { API->SetFrustumColorGrading(FrustumColorGrading); }, true });
+	Calls.Add({ TEXT("GetStageState"), [API]() { API->GetStageState(); } });
+	Calls.Add({ TEXT("GetStageStateCached"), [API]() { API->GetStageStateCached(); } });
+	Calls.Add({ TEXT("GetViewportNames"), [API]() { API->GetViewportNames(); } });
+	Calls.Add({ TEXT("GetClusterNodeNames"), [API]() { API->GetClusterNodeNames(); } });
+	Calls.Add({ TEXT("GetViewportNodeName"), [API, FirstViewport]() { API->GetViewportNodeName(FirstViewport); } });
+	Calls.Add({ TEXT("GetViewportRenderSettings"), [API, FirstViewport]() { API->GetViewportRenderSettings(FirstViewport); } });
+	Calls.Add({ TEXT("SetViewportRenderSettings"), [API, ViewportNames, ViewportSettings]() { API->SetViewportRenderSettings(ViewportNames, ViewportSettings); }, true });
+	Calls.Add({ TEXT("GetIcvfxCameraComponentA"), [API]() { API->GetIcvfxCameraComponentA(); } });
+	Calls.Add({ TEXT("GetIcvfxCameraComponentB"), [API]() { API->GetIcvfxCameraComponentB(); } });
+	Calls.Add({ TEXT("CameraBActive"), [API]() { API->CameraBActive(); } });
+	Calls.Add({ TEXT("GetRootNames"), [API]() { API->GetRootNames(); } });
+
+	//Stage transform, the typed setters do more than the property path (attach parent lookup, local vs world)
+	FVector const StagePosition = API->GetStagePosition();
+	FRotator const StageWorldRotation = API->GetStageWorldRotation();
+	FRotator const StageLocalRotation = API->GetStageLocalRotation();
+	FVector const DefaultViewPosition = API->GetDefaultViewPosition();
+
+	Calls.Add({ TEXT("GetStagePosition"), [API]() { API->GetStagePosition(); } });
+	Calls.Add({ TEXT("GetStageWorldRotation"), [API]() { API->GetStageWorldRotation(); } });
+	Calls.Add({ TEXT("GetStageLocalRotation"), [API]() { API->GetStageLocalRotation(); } });
+	Calls.Add({ TEXT("SetStageLocation"), [API, StagePosition, StageWorldRotation]() { API->SetStageLocation(StagePosition, StageWorldRotation); }, true });
+	Calls.Add({ TEXT("AddStageLocalOffset"), [API]() { API->AddStageLocalOffset(FVector::ZeroVector); }, true });
+	Calls.Add({ TEXT("SetStageWorldRotation"), [API, StageWorldRotation]() { API->SetStageWorldRotation(StageWorldRotation); }, true });
+	Calls.Add({ TEXT("SetStageLocalRotation"), [API, StageLocalRotation]() { API->SetStageLocalRotation(StageLocalRotation); }, true });
+	Calls.Add({ TEXT("SetDefaultViewPositionPreview"), [API, DefaultViewPosition]() { API->SetDefaultViewPositionPreview(DefaultViewPosition); } });
+
+	//Camera A through the per component calls, positions and rotations are relative to the camera's parent
+	UDisplayClusterICVFXCameraComponent* const CameraA = API->GetIcvfxCameraComponentA();
+	float const FOVMult = API->GetFrustumFOVMult_ByComponent(CameraA);
+	float const Exposure = API->GetFrustumExposure_ByComponent(CameraA);
+	float const Aperture = API->GetFrustumAperture_ByComponent(CameraA);
+	float const FocalDistance = API->GetFrustumFocalDistance_ByComponent(CameraA);
+	FVector4 const FrustumPosition = API->GetPropertyValue(EStageAPIProperty::FrustumPosition);
+	FVector4 const FrustumRotation = API->GetPropertyValue(EStageAPIProperty::FrustumRotation);
+	FVector4 const FrustumPositionB = API->GetPropertyValue(EStageAPIProperty::FrustumPositionB);
+	FVector4 const FrustumRotationB = API->GetPropertyValue(EStageAPIProperty::FrustumRotationB);
+
+	Calls.Add({ TEXT("GetFrustumFOVMult_ByComponent"), [API, CameraA]() { API->GetFrustumFOVMult_ByComponent(CameraA); } });
+	Calls.Add({ TEXT("SetFrustumFOVMult_ByComponent"), [API, CameraA, FOVMult]() { API->SetFrustumFOVMult_ByComponent(CameraA, FOVMult); }, true });
+	Calls.Add({ TEXT("GetFrustumExposure_ByComponent"), [API, CameraA]() { API->GetFrustumExposure_ByComponent(CameraA); } });
+	Calls.Add({ TEXT("SetFrustumExposure_ByComponent"), [API, CameraA, Exposure]() { API->SetFrustumExposure_ByComponent(CameraA, Exposure); }, true });
+	Calls.Add({ TEXT("GetFrustumAperture_ByComponent"), [API, CameraA]() { API->GetFrustumAperture_ByComponent(CameraA); } });
+	Calls.Add({ TEXT("SetFrustumAperture_ByComponent"), [API, CameraA, Aperture]() { API->SetFrustumAperture_ByComponent(CameraA, Aperture); }, true });
+	Calls.Add({ TEXT("GetFrustumFocalDistance_ByComponent"), [API, CameraA]() { API->GetFrustumFocalDistance_ByComponent(CameraA); } });
+	Calls.Add({ TEXT("SetFrustumFocalDistance_ByComponent"), [API, CameraA, FocalDistance]() { API->SetFrustumFocalDistance_ByComponent(CameraA, FocalDistance); }, true });
+	Calls.Add({ TEXT("GetFrustumPosition_ByComponent"), [API, CameraA]() { API->GetFrustumPosition_ByComponent(CameraA); } });
+	Calls.Add({ TEXT("SetFrustumPosition_ByComponent"), [API, CameraA, FrustumPosition]() { API->SetFrustumPosition_ByComponent(CameraA, FVector(FrustumPosition)); }, true });
+	Calls.Add({ TEXT("GetFrustumRotation_ByComponent"), [API, CameraA]() { API->GetFrustumRotation_ByComponent(CameraA); } });
+	Calls.Add({ TEXT("SetFrustumRotation_ByComponent"), [API, CameraA, FrustumRotation]() { API->SetFrustumRotation_ByComponent(CameraA, FRotator(FrustumRotation.X, FrustumRotation.Y, FrustumRotation.Z)); }, true });
+
+	//Previews move the cameras without a transaction
+	Calls.Add({ TEXT("SetFrustumPositionPreview_ByComponent"), [API, CameraA, FrustumPosition]() { API->SetFrustumPositionPreview_ByComponent(CameraA, FVector(FrustumPosition)); } });
+	Calls.Add({ TEXT("SetFrustumRotationPreview_ByComponent"), [API, CameraA, FrustumRotation]() { API->SetFrustumRotationPreview_ByComponent(CameraA, FRotator(FrustumRotation.X, FrustumRotation.Y, FrustumRotation.Z)); } });
+	Calls.Add({ TEXT("SetFrustumPositionPreview"), [API, FrustumPosition]() { API->SetFrustumPositionPreview(FVector(FrustumPosition)); } });
+	Calls.Add({ TEXT("SetFrustumRotationPreview"), [API, FrustumRotation]() { API->SetFrustumRotationPreview(FRotator(FrustumRotation.X, FrustumRotation.Y, FrustumRotation.Z)); } });
+	Calls.Add({ TEXT("SetFrustumPositionPreviewB"), [API, FrustumPositionB]() { API->SetFrustumPositionPreviewB(FVector(FrustumPositionB)); } });
+	Calls.Add({ TEXT("SetFrustumRotationPreviewB"), [API, FrustumRotationB]() { API->SetFrustumRotationPreviewB(FRotator(FrustumRotationB.X, FrustumRotationB.Y, FrustumRotationB.Z)); } });
+
+	//Sequencer, the frame time is written back unchanged
+	FFrameTime const SequencerFrameTime = API->GetSequencerFrameTime(EStageAPISequencerTimeBase::TickResolution);
+
+	Calls.Add({ TEXT("GetSequencerStatus"), [API]() { API->GetSequencerStatus(); } });
+	Calls.Add({ TEXT("GetSequencerStatusCached"), [API]() { API->GetSequencerStatusCached(); } });
+	Calls.Add({ TEXT("GetSequencerTime"), [API]() { API->GetSequencerTime(); } });
+	Calls.Add({ TEXT("GetSequencerFrameTime"), [API]() { API->GetSequencerFrameTime(EStageAPISequencerTimeBase::DisplayRate); } });
+	Calls.Add({ TEXT("GetSequencerTimecode"), [API]() { API->GetSequencerTimecode(); } });
+	Calls.Add({ TEXT("IsSequencerPlaying"), [API]() { API->IsSequencerPlaying(); } });
+	Calls.Add({ TEXT("SetSequencerFrameTime"), [API, SequencerFrameTime]() { API->SetSequencerFrameTime(SequencerFrameTime, EStageAPISequencerTimeBase::TickResolution); } });
+
+	//Root targeting, bulk calls go through the benchmark tag so other roots in the level are left alone
+	FName const RootName = API->GetActiveRootName();
+	FVector4 const StageExposure = API->GetPropertyValue(EStageAPIProperty::StageExposure);
+
+	Calls.Add({ TEXT("FindRoot"), [API, RootName]() { API->FindRoot(RootName); } });
+	Calls.Add({ TEXT("GetRootNamesWithTag"), [API]() { API->GetRootNamesWithTag(StageAPIBenchmarkName); } });
+	Calls.Add({ TEXT("SetActiveRoot"), [API, RootName]() { API->SetActiveRoot(RootName); } });
+	Calls.Add({ TEXT("PushPopTargetRoot"), [API, RootName]() { if (API->PushTargetRoot(RootName)) { API->PopTargetRoot(); } } });
+	Calls.Add({ TEXT("GetPropertyValueOnRoot"), [API, RootName]() { API->GetPropertyValueOnRoot(RootName, EStageAPIProperty::StageExposure); } });
+	Calls.Add({ TEXT("SetPropertyValueOnRoot"), [API, RootName, StageExposure]() { API->SetPropertyValueOnRoot(RootName, EStageAPIProperty::StageExposure, StageExposure); }, true });
+	Calls.Add({ TEXT("SetPropertyValueOnRootsWithTag"), [API, StageExposure]() { API->SetPropertyValueOnRootsWithTag(StageAPIBenchmarkName, EStageAPIProperty::StageExposure, StageExposure); }, true });
+
+	//Presets, the benchmark preset is captured from the current stage so recalling it changes nothing
+	Calls.Add({ TEXT("CapturePreset"), [API]() { API->CapturePreset(StageAPIBenchmarkName); } });
+	Calls.Add({ TEXT("RecallPreset"), [API]() { API->RecallPreset(StageAPIBenchmarkName); }, true });
+	Calls.Add({ TEXT("GetPresetNames"), [API]() { API->GetPresetNames(); } });
+
+	//Render tiers, a tier holding the current viewport settings
+	FStageAPIRenderTier BenchmarkTier;
+	BenchmarkTier.Entries.AddDefaulted_GetRef().Settings = ViewportSettings;
+
+	Calls.Add({ TEXT("SetRenderTier"), [API, BenchmarkTier]() { API->SetRenderTier(StageAPIBenchmarkName, BenchmarkTier); } });
+	Calls.Add({ TEXT("ApplyRenderTier"), [API]() { API->ApplyRenderTier(StageAPIBenchmarkName); }, true });
+	Calls.Add({ TEXT("GetRenderTierNames"), [API]() { API->GetRenderTierNames(); } });
+
+	//Transitions, started towards the current value and cancelled back to it
+	Calls.Add({ TEXT("StartCancelTransition"), [API, StageExposure]()
+	{
+		API->StartTransition(EStageAPIProperty::StageExposure, StageExposure, 1.0f);
+		API->CancelTransition(EStageAPIProperty::StageExposure);
+	}, true });
+	Calls.Add({ TEXT("IsTransitionActive"), [API]() { API->IsTransitionActive(EStageAPIProperty::StageExposure); } });
+	return Calls;
+}
+
+/**
+ * @brief Undoes the transactions a setter just added without keeping them for redo, so timing thousands of setter
+ * calls leaves the undo history as it was.
+ */
+static void s_DropBenchmarkTransaction(int32 QueueLength)
+{
+	while (GEditor->Trans->GetQueueLength() > QueueLength)
+	{
+		GEditor->UndoTransaction(false);
+	}
+}
+
+static FStageAPIBenchmarkResult s_MeasureCall(const FStageAPIBenchmarkCall& Call, int32 Iterations)
+{
+	int32 const QueueLength = GEditor->Trans->GetQueueLength();
+
+	//Warm caches (topology, camera index, default view point) so the first call does not skew p99
+	for (int32 WarmupIdx = 0; WarmupIdx < 8; ++WarmupIdx)
+	{
+		Call.Call();
+		if (Call.bTransacted)
+		{
+			s_DropBenchmarkTransaction(QueueLength);
+		}
+	}
+
+	TArray<uint64> Samples;
+	Samples.SetNumUninitialized(Iterations);
+
+	//Dropping the undo entry inside the loop frees what the transaction held, so only memory the call keeps remains
+	uint64 const UsedMemoryBefore = FPlatformMemory::GetStats().UsedVirtual;
+	for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+	{
+		uint64 const StartCycles = FPlatformTime::Cycles64();
+		Call.Call();
+		Samples[Iteration] = FPlatformTime::Cycles64() - StartCycles;
+
+		if (Call.bTransacted)
+		{
+			s_DropBenchmarkTransaction(QueueLength);
+		}
+	}
+	uint64 const UsedMemoryAfter = FPlatformMemory::GetStats().UsedVirtual;
+
+	Samples.Sort();
+	uint64 TotalCycles = 0;
+	for (uint64 Sample : Samples)
+	{
+		TotalCycles += Sample;
+	}
+
+	auto CyclesToUs = [](double Cycles) { return Cycles * FPlatformTime::GetSecondsPerCycle64() * 1.e6; };
+
+	FStageAPIBenchmarkResult Result;
+	Result.Name = Call.Name;
+	Result.MeanUs = CyclesToUs(static_cast<double>(TotalCycles) / Iterations);
+	Result.P50Us = CyclesToUs(static_cast<double>(Samples[(Iterations - 1) / 2]));
+	Result.P99Us = CyclesToUs(static_cast<double>(Samples[(Iterations - 1) * 99 / 100]));
+	Result.BytesPerCall = UsedMemoryAfter > UsedMemoryBefore ? static_cast<double>(UsedMemoryAfter - UsedMemoryBefore) / Iterations : 0.0;
+	return Result;
+}
+
+static TSharedRef<FJsonObject> s_BenchmarkToJson(const TArray<FStageAPIBenchmarkResult>& Results, int32 NumNodes, int32 ViewportsPerNode, int32 NumCameras, int32 Iterations)
+{
+	TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+
+	TSharedRef<FJsonObject> Config = MakeShared<FJsonObject>();
+	Config->SetNumberField(TEXT("Nodes"), NumNodes);
+	Config->SetNumberField(TEXT("ViewportsPerNode"), ViewportsPerNode);
+	Config->SetNumberField(TEXT("Cameras"), NumCameras);
+	Config->SetNumberField(TEXT("Iterations"), Iterations);
+	Root->SetObjectField(TEXT("Config"), Config);
+
+	TArray<TSharedPtr<FJsonValue>> JsonResults;
+	for (const FStageAPIBenchmarkResult& Result : Results)
+	{
+		TSharedRef<FJsonObject> JsonResult = MakeShared<FJsonObject>();
+		JsonResult->SetStringField(TEXT("Name"), Result.Name);
+		JsonResult->SetNumberField(TEXT("MeanUs"), Result.MeanUs);
+		JsonResult->SetNumberField(TEXT("P50Us"), Result.P50Us);
+		JsonResult->SetNumberField(TEXT("P99Us"), Result.P99Us);
+		JsonResult->SetNumberField(TEXT("BytesPerCall"), Result.BytesPerCall);
+		JsonResults.Add(MakeShared<FJsonValueObject>(JsonResult));
+	}
+	Root->SetArrayField(TEXT("Results"), JsonResults);
+	return Root;
+}
+
+static bool s_WriteJsonFile(const TSharedRef<FJsonObject>& Json, const FString& Path)
+{
+	FString JsonString;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&JsonString);
+	return FJsonSerializer::Serialize(Json, Writer) && FFileHelper::SaveStringToFile(JsonString, *Path);
+}
+
+/**
+ * @brief Logs every call whose p50 got slower than the baseline by more than ThresholdPercent or that retains more
+ * memory per call. Returns the number of regressions, 0 without a baseline file and INDEX_NONE if the baseline is unreadable.
+ */
+static int32 s_CompareWithBaseline(const TArray<FStageAPIBenchmarkResult>& Results, const FString& BaselinePath, float ThresholdPercent)
+{
+	FString BaselineString;
+	if (!FFileHelper::LoadFileToString(BaselineString, *BaselinePath))
+	{
+		UE_LOG(StageAPIEditor, Warning, TEXT("StageAPI.Benchmark: no baseline at '%s', comparison skipped. Run with WriteBaseline on the reference stage to create one"), *BaselinePath);
+		return 0;
+	}
+
+	TSharedPtr<FJsonObject> Baseline;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(BaselineString);
+	if (!FJsonSerializer::Deserialize(Reader, Baseline) || !Baseline.IsValid())
+	{
+		UE_LOG(StageAPIEditor, Error, TEXT("StageAPI.Benchmark: baseline '%s' is not valid JSON"), *BaselinePath);
+		return INDEX_NONE;
+	}
+
+	TMap<FString, TSharedPtr<FJsonObject>> BaselineResults;
+	const TArray<TSharedPtr<FJsonValue>>* JsonResults = nullptr;
+	if (Baseline->TryGetArrayField(TEXT("Results"), JsonResults))
+	{
+		for (const TSharedPtr<FJsonValue>& JsonResult : *JsonResults)
+		{
+			TSharedPtr<FJsonObject> ResultObject = JsonResult->AsObject();
+			if (ResultObject.IsValid())
+			{
+				BaselineResults.Add(ResultObject->GetStringField(TEXT("Name")), ResultObject);
+			}
+		}
+	}
+
+	int32 NumRegressions = 0;
+	for (const FStageAPIBenchmarkResult& Result : Results)
+	{
+		const TSharedPtr<FJsonObject>* BaselineResult = BaselineResults.Find(Result.Name);
+		if (!BaselineResult)
+			continue;
+
+		double const BaselineP50 = (*BaselineResult)->GetNumberField(TEXT("P50Us"));
+		double const BaselineBytes = (*BaselineResult)->GetNumberField(TEXT("BytesPerCall"));
+
+		//Calls under a tenth of a microsecond are timer noise
+		bool const bSlower = Result.P50Us > 0.1 && Result.P50Us > BaselineP50 * (1.0 + ThresholdPercent / 100.0);
+		//Process wide stats, growth under a few hundred bytes per call is other threads and allocator pooling
+		bool const bMoreMemory = Result.BytesPerCall > BaselineBytes * (1.0 + ThresholdPercent / 100.0) + 256.0;
+		if (bSlower || bMoreMemory)
+		{
+			++NumRegressions;
+			UE_LOG(StageAPIEditor, Warning, TEXT("StageAPI.Benchmark regression %s: p50 %.3fus (baseline %.3fus), memory %.1fB (baseline %.1fB)"),
+				*Result.Name, Result.P50Us, BaselineP50, Result.BytesPerCall, BaselineBytes);
+		}
+	}
+	return NumRegressions;
+}
+
+/** @brief Runs the benchmark with console style arguments, returns false if it could not run or regressed */
+static bool s_RunBenchmark(const FString& CommandLine)
+{
+	int32 NumNodes = 4;
+	int32 ViewportsPerNode = 4;
+	int32 NumCameras = 2;
+	int32 Iterations = 1000;
+	float ThresholdPercent = 25.0f;
+	FParse::Value(*CommandLine, TEXT("Nodes="), NumNodes);
+	FParse::Value(*CommandLine, TEXT("ViewportsPerNode="), ViewportsPerNode);
+	FParse::Value(*CommandLine, TEXT("Cameras="), NumCameras);
+	FParse::Value(*CommandLine, TEXT("Iterations="), Iterations);
+	FParse::Value(*CommandLine, TEXT("Threshold="), ThresholdPercent);
+	Iterations = FMath::Max(Iterations, 1);
+
+	FString OutputPath = FPaths::ProjectSavedDir() / TEXT("VPStageAPI") / TEXT("Benchmark.json");
+	FParse::Value(*CommandLine, TEXT("Output="), OutputPath);
+
+	FString BaselinePath;
+	if (TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin(TEXT("VPStageAPI")))
+	{
+		BaselinePath = Plugin->GetBaseDir() / TEXT("Resources") / TEXT("Benchmark") / TEXT("StageAPIBaseline.json");
+	}
+	FParse::Value(*CommandLine, TEXT("Baseline="), BaselinePath);
+
+	bool const bWriteBaseline = FParse::Param(*CommandLine, TEXT("WriteBaseline"));
+
+	UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+	if (!World)
+	{
+		UE_LOG(StageAPIEditor, Error, TEXT("StageAPI.Benchmark needs an editor world"));
+		return false;
+	}
+
+	TScriptInterface<IStageAPIEditor> ScriptAPI;
+	UStageAPIBlueprintFunctionLibrary::GetAPI(ScriptAPI);
+	IStageAPIEditor* API = ScriptAPI.GetInterface();
+
+	TArray<AActor*> SpawnedActors;
+	ADisplayClusterRootActor* Root = s_SpawnBenchmarkRoot(World, NumNodes, ViewportsPerNode, NumCameras, SpawnedActors);
+	FName const PreviousActiveRoot = API->GetActiveRootName();
+	bool const bWasCoalescing = API->IsWriteCoalescingEnabled();
+
+	if (!Root || !API->SetActiveRoot(Root->GetFName()))
+	{
+		UE_LOG(StageAPIEditor, Error, TEXT("StageAPI.Benchmark could not create the synthetic nDisplay root"));
+		for (AActor* Actor : SpawnedActors)
+		{
+			World->EditorDestroyActor(Actor, false);
+		}
+		return false;
+	}
+
+	//Setters apply immediately, each in its own transaction like a single call from a widget or Remote Control
+	API->SetWriteCoalescing(false);
+
+	TArray<FStageAPIBenchmarkResult> Results;
+	for (const FStageAPIBenchmarkCall& Call : s_BuildBenchmarkCalls(API))
+	{
+		Results.Add(s_MeasureCall(Call, Iterations));
+	}
+
+	API->SetWriteCoalescing(bWasCoalescing);
+	API->DeletePreset(StageAPIBenchmarkName);
+	if (!PreviousActiveRoot.IsNone())
+	{
+		API->SetActiveRoot(PreviousActiveRoot);
+	}
+	for (AActor* Actor : SpawnedActors)
+	{
+		World->EditorDestroyActor(Actor, false);
+	}
+
+	for (const FStageAPIBenchmarkResult& Result : Results)
+	{
+		UE_LOG(StageAPIEditor, Display, TEXT("%-32s mean %8.3fus  p50 %8.3fus  p99 %8.3fus  memory %8.1fB"),
+			*Result.Name, Result.MeanUs, Result.P50Us, Result.P99Us, Result.BytesPerCall);
+	}
+
+	TSharedRef<FJsonObject> Json = s_BenchmarkToJson(Results, NumNodes, ViewportsPerNode, NumCameras, Iterations);
+	if (!s_WriteJsonFile(Json, OutputPath))
+	{
+		UE_LOG(StageAPIEditor, Error, TEXT("StageAPI.Benchmark could not write '%s'"), *OutputPath);
+	}
+
+	bool bPassed = true;
+	if (bWriteBaseline)
+	{
+		bPassed = s_WriteJsonFile(Json, BaselinePath);
+		if (bPassed)
+		{
+			UE_LOG(StageAPIEditor, Display, TEXT("StageAPI.Benchmark wrote baseline '%s'"), *BaselinePath);
+		}
+		else
+		{
+			UE_LOG(StageAPIEditor, Error, TEXT("StageAPI.Benchmark could not write baseline '%s'"), *BaselinePath);
+		}
+	}
+	else
+	{
+		//A corrupt baseline fails the run, a missing one only warns until it has been recorded
+		int32 const NumRegressions = s_CompareWithBaseline(Results, BaselinePath, ThresholdPercent);
+		bPassed = NumRegressions == 0;
+		if (NumRegressions != INDEX_NONE)
+		{
+			UE_LOG(StageAPIEditor, Display, TEXT("StageAPI.Benchmark: %d calls, %d regressions, results in '%s'"), Results.Num(), NumRegressions, *OutputPath);
+		}
+	}
+
+	return bPassed;
+}
+
+static void s_RunBenchmarkCommand(const TArray<FString>& Args)
+{
+	FString const CommandLine = FString::Join(Args, TEXT(" "));
+	bool const bPassed = s_RunBenchmark(CommandLine);
+
+	if (FParse::Param(*CommandLine, TEXT("Quit")))
+	{
+		FPlatformMisc::RequestExitWithStatus(false, bPassed ? 0 : 1);
+	}
+}
+
+static FAutoConsoleCommand StageAPIBenchmarkCommand(
+	TEXT("StageAPI.Benchmark"),
+	TEXT("Times the Stage API property, stage transform, per component, preview, Sequencer, root, preset, render tier, transition, grade and topology calls on a synthetic nDisplay root and compares against the baseline. ")
+	TEXT("Args: Nodes= ViewportsPerNode= Cameras= Iterations= Output= Baseline= Threshold= WriteBaseline Quit"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&s_RunBenchmarkCommand));
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FStageAPIBenchmarkTest, "VPStageAPI.Benchmark",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FStageAPIBenchmarkTest::RunTest(const FString& Parameters)
+{
+	return TestTrue(TEXT("Benchmark ran without regressions"), s_RunBenchmark(Parameters));
+}
+
+#endif
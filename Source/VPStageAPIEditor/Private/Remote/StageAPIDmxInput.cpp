@@ -0,0 +1,357 @@
+#include "StageAPIDmxInput.h"
+#include "VPStageAPIEditorModule.h"
+#include "StageAPIBlueprintFunctionLibrary.h"
+#include "API/IStageAPIEditor.h"
+#include "Common/UdpSocketBuilder.h"
+#include "Common/UdpSocketReceiver.h"
+#include "Sockets.h"
+#include "SocketSubsystem.h"
+
+#if PLATFORM_CPU_X86_FAMILY
+#include <emmintrin.h>
+#define STAGEAPI_DMX_SSE2 1
+#else
+#define STAGEAPI_DMX_SSE2 0
+#endif
+
+//One bit per slot of a universe
+typedef uint64 FDmxChangeMask[FStageAPIDmxInput::UniverseSize / 64];
+
+//Sets a bit for every slot that differs between the two universes. Returns true if any did
+static bool s_DiffDmxUniverse(const uint8* Previous, const uint8* Current, FDmxChangeMask& OutChanged)
+{
+	uint64 AnyChanged = 0;
+
+	for (int32 Block = 0; Block < UE_ARRAY_COUNT(OutChanged); ++Block)
+	{
+		uint64 Bits = 0;
+		int32 const BlockOffset = Block * 64;
+
+#if STAGEAPI_DMX_SSE2
+		for (int32 Lane = 0; Lane < 4; ++Lane)
+		{
+			__m128i const A = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Previous + BlockOffset + Lane * 16));
+			__m128i const B = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Current + BlockOffset + Lane * 16));
+			uint32 const Equal = static_cast<uint32>(_mm_movemask_epi8(_mm_cmpeq_epi8(A, B)));
+			Bits |= static_cast<uint64>(~Equal & 0xFFFF) << (Lane * 16);
+		}
+#else
+		for (int32 Slot = 0; Slot < 64; ++Slot)
+		{
+			Bits |= static_cast<uint64>(Previous[BlockOffset + Slot] != Current[BlockOffset + Slot]) << Slot;
+		}
+#endif
+
+		OutChanged[Block] = Bits;
+		AnyChanged |= Bits;
+	}
+	return AnyChanged != 0;
+}
+
+static bool s_IsDmxSlotChanged(const FDmxChangeMask& Changed, int32 Slot)
+{
+	return (Changed[Slot >> 6] >> (Slot & 63)) & 1;
+}
+
+static uint16 s_ReadDmxUInt16BE(const uint8* Data)
+{
+	return static_cast<uint16>((Data[0] << 8) | Data[1]);
+}
+
+FStageAPIDmxInput::FStageAPIDmxInput()
+{
+}
+
+FStageAPIDmxInput::~FStageAPIDmxInput()
+{
+	StopListening();
+}
+
+bool FStageAPIDmxInput::StartListening(EStageAPIDmxProtocol InProtocol, const FIPv4Address& BindAddress)
+{
+	if (IsListening())
+		return false;
+
+	Protocol = InProtocol;
+	FIPv4Endpoint const Endpoint(BindAddress, Protocol == EStageAPIDmxProtocol::ArtNet ? ArtNetPort : SacnPort);
+
+	Socket = FUdpSocketBuilder(TEXT("StageAPIDmx"))
+		.AsNonBlocking()
+		.AsReusable()
+		.BoundToEndpoint(Endpoint)
+		.WithReceiveBufferSize(1024 * 1024)
+		.Build();
+
+	if (!Socket)
+	{
+		UE_LOG(StageAPIEditor, Error, TEXT("VP Stage API DMX input could not bind %s"), *Endpoint.ToString());
+		return false;
+	}
+
+	//sACN is multicast, one group per universe
+	JoinedUniverses.Reset();
+	for (const FStageAPIDmxMapping& Mapping : Mappings)
+	{
+		JoinUniverseGroup(Mapping.Universe);
+	}
+
+	Receiver = new FUdpSocketReceiver(Socket, FTimespan::FromMilliseconds(10), TEXT("StageAPIDmxReceiver"));
+	Receiver->OnDataReceived().BindRaw(this, &FStageAPIDmxInput::HandlePacket);
+	Receiver->Start();
+
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FStageAPIDmxInput::Tick));
+
+	UE_LOG(StageAPIEditor, Log, TEXT("VP Stage API DMX input (%s) on %s"), Protocol == EStageAPIDmxProtocol::ArtNet ? TEXT("Art-Net") : TEXT("sACN"), *Endpoint.ToString());
+	return true;
+}
+
+void FStageAPIDmxInput::StopListening()
+{
+	if (!IsListening())
+		return;
+
+	FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+	TickerHandle.Reset();
+
+	//Stops and joins the receiver thread
+	delete Receiver;
+	Receiver = nullptr;
+
+	ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(Socket);
+	Socket = nullptr;
+	JoinedUniverses.Reset();
+
+	//The first frame after a restart seeds the baseline again
+	ReceivedUniverses.Reset();
+	AppliedUniverses.Reset();
+}
+
+void FStageAPIDmxInput::AddMapping(const FStageAPIDmxMapping& Mapping)
+{
+	if (Mapping.Property == EStageAPIProperty::None || Mapping.Property >= EStageAPIProperty::Count)
+		return;
+
+	//Takes effect from the next change of its channels
+	Mappings.Add(Mapping);
+
+	if (IsListening())
+	{
+		JoinUniverseGroup(Mapping.Universe);
+	}
+}
+
+void FStageAPIDmxInput::ClearMappings()
+{
+	Mappings.Reset();
+}
+
+void FStageAPIDmxInput::AddDefaultPatch(uint16 Universe)
+{
+	uint16 Channel = 1;
+	auto Patch = [this, Universe, &Channel](EStageAPIProperty Property, uint8 Component, float Min, float Max)
+	{
+		FStageAPIDmxMapping Mapping;
+		Mapping.Universe = Universe;
+		Mapping.Channel = Channel;
+		Mapping.b16Bit = true;
+		Mapping.Property = Property;
+		Mapping.Component = Component;
+		Mapping.Min = Min;
+		Mapping.Max = Max;
+		AddMapping(Mapping);
+		Channel += 2;
+	};
+
+	Patch(EStageAPIProperty::StageExposure, 0, -8.0f, 8.0f);
+	Patch(EStageAPIProperty::FrustumExposure, 0, -8.0f, 8.0f);
+	Patch(EStageAPIProperty::FrustumFocalDistance, 0, 0.0f, 10000.0f);
+	Patch(EStageAPIProperty::FrustumAperture, 0, 0.7f, 32.0f);
+
+	//Both grades share a layout, offset is centred on zero and everything else on one
+	for (EStageAPIProperty FirstGradeProperty : { EStageAPIProperty::ClusterGlobalSaturation, EStageAPIProperty::FrustumGlobalSaturation })
+	{
+		for (uint8 GradeIndex = 0; GradeIndex < 8; ++GradeIndex)
+		{
+			EStageAPIProperty const Property = static_cast<EStageAPIProperty>(static_cast<uint8>(FirstGradeProperty) + GradeIndex);
+			bool const bOffset = Property == EStageAPIProperty::ClusterGlobalOffset || Property == EStageAPIProperty::FrustumGlobalOffset;
+			for (uint8 Component = 0; Component < 4; ++Component)
+			{
+				Patch(Property, Component, bOffset ? -1.0f : 0.0f, bOffset ? 1.0f : 2.0f);
+			}
+		}
+	}
+}
+
+void FStageAPIDmxInput::JoinUniverseGroup(uint16 Universe)
+{
+	if (Protocol != EStageAPIDmxProtocol::Sacn || JoinedUniverses.Contains(Universe))
+		return;
+
+	JoinedUniverses.Add(Universe);
+
+	TSharedRef<FInternetAddr> GroupAddress = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->CreateInternetAddr();
+	GroupAddress->SetIp(FIPv4Address(239, 255, static_cast<uint8>(Universe >> 8), static_cast<uint8>(Universe & 0xFF)).Value);
+	if (!Socket->JoinMulticastGroup(*GroupAddress))
+	{
+		UE_LOG(StageAPIEditor, Warning, TEXT("VP Stage API DMX input could not join the sACN group of universe %d"), Universe);
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+// Receiver thread
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+void FStageAPIDmxInput::HandlePacket(const TSharedPtr<FArrayReader, ESPMode::ThreadSafe>& Data, const FIPv4Endpoint& Sender)
+{
+	const uint8* Packet = Data->GetData();
+	int32 const Size = Data->Num();
+
+	if (Protocol == EStageAPIDmxProtocol::ArtNet)
+	{
+		//ArtDmx: ID, OpCode (little endian), ProtVer, Sequence, Physical, SubUni, Net, Length, Data
+		static const uint8 ArtNetId[8] = { 'A', 'r', 't', '-', 'N', 'e', 't', 0 };
+		if (Size < 18 || FMemory::Memcmp(Packet, ArtNetId, sizeof(ArtNetId)) != 0)
+			return;
+
+		uint16 const OpCode = static_cast<uint16>(Packet[8] | (Packet[9] << 8));
+		if (OpCode != 0x5000)
+			return;
+
+		uint16 const Universe = static_cast<uint16>(((Packet[15] & 0x7F) << 8) | Packet[14]);
+		int32 const SlotCount = FMath::Min<int32>(s_ReadDmxUInt16BE(Packet + 16), Size - 18);
+		StoreUniverse(Universe, Packet + 18, SlotCount);
+	}
+	else
+	{
+		//E1.31 data packet: root layer, framing layer, DMP layer. Only the fields used here are checked
+		static const uint8 AcnId[12] = { 'A', 'S', 'C', '-', 'E', '1', '.', '1', '7', 0, 0, 0 };
+		if (Size < 126 || FMemory::Memcmp(Packet + 4, AcnId, sizeof(AcnId)) != 0)
+			return;
+
+		//Root vector 4 (E1.31 data), framing vector 2 (DMP), DMP vector 2 (set property)
+		if (Packet[21] != 0x04 || Packet[43] != 0x02 || Packet[117] != 0x02)
+			return;
+
+		//Preview data and terminated streams carry nothing to apply
+		uint8 const Options = Packet[112];
+		if (Options & 0xC0)
+			return;
+
+		//Only the null start code carries dimmer levels
+		if (Packet[125] != 0)
+			return;
+
+		uint16 const Universe = s_ReadDmxUInt16BE(Packet + 113);
+		int32 const SlotCount = FMath::Min<int32>(s_ReadDmxUInt16BE(Packet + 123) - 1, Size - 126);
+		StoreUniverse(Universe, Packet + 126, SlotCount);
+	}
+}
+
+void FStageAPIDmxInput::StoreUniverse(uint16 Universe, const uint8* Slots, int32 SlotCount)
+{
+	SlotCount = FMath::Clamp(SlotCount, 0, UniverseSize);
+
+	FScopeLock Lock(&ReceivedLock);
+	FUniverseSlots& Received = ReceivedUniverses.FindOrAdd(Universe);
+	FMemory::Memcpy(Received.Channels, Slots, SlotCount);
+	FMemory::Memzero(Received.Channels + SlotCount, UniverseSize - SlotCount);
+	Received.bDirty = true;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+// Game thread
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+bool FStageAPIDmxInput::Tick(float DeltaTime)
+{
+	//Take the universes received since the last tick, the lock is only held for the copies
+	TArray<TPair<uint16, FUniverseSlots>, TInlineAllocator<4>> Frames;
+	{
+		FScopeLock Lock(&ReceivedLock);
+		for (TPair<uint16, FUniverseSlots>& Received : ReceivedUniverses)
+		{
+			if (Received.Value.bDirty)
+			{
+				Frames.Add(Received);
+				Received.Value.bDirty = false;
+			}
+		}
+	}
+
+	if (Frames.Num() == 0)
+		return true;
+
+	//Decoded component values per property, only components whose channels changed are set
+	FVector4 Values[static_cast<uint8>(EStageAPIProperty::Count)];
+	uint8 ComponentMasks[static_cast<uint8>(EStageAPIProperty::Count)] = {};
+	bool bAnyChanged = false;
+
+	for (const TPair<uint16, FUniverseSlots>& Frame : Frames)
+	{
+		FAppliedUniverse& Applied = AppliedUniverses.FindOrAdd(Frame.Key);
+
+		//The first frame of a universe only seeds the baseline, a desk connecting must not snap the stage to its faders
+		if (!Applied.bValid)
+		{
+			FMemory::Memcpy(Applied.Channels, Frame.Value.Channels, UniverseSize);
+			Applied.bValid = true;
+			continue;
+		}
+
+		FDmxChangeMask Changed;
+		if (!s_DiffDmxUniverse(Applied.Channels, Frame.Value.Channels, Changed))
+			continue;
+
+		FMemory::Memcpy(Applied.Channels, Frame.Value.Channels, UniverseSize);
+
+		for (const FStageAPIDmxMapping& Mapping : Mappings)
+		{
+			int32 const Slot = Mapping.Channel - 1;
+			int32 const LastSlot = Slot + (Mapping.b16Bit ? 1 : 0);
+			if (Mapping.Universe != Frame.Key || Slot < 0 || LastSlot >= UniverseSize || Mapping.Component > 3)
+				continue;
+
+			if (!s_IsDmxSlotChanged(Changed, Slot) && !s_IsDmxSlotChanged(Changed, LastSlot))
+				continue;
+
+			float const Level = Mapping.b16Bit
+				? s_ReadDmxUInt16BE(Frame.Value.Channels + Slot) / 65535.0f
+				: Frame.Value.Channels[Slot] / 255.0f;
+
+			uint8 const PropertyIndex = static_cast<uint8>(Mapping.Property);
+			Values[PropertyIndex][Mapping.Component] = FMath::Lerp(Mapping.Min, Mapping.Max, Level);
+			ComponentMasks[PropertyIndex] |= 1 << Mapping.Component;
+			bAnyChanged = true;
+		}
+	}
+
+	if (!bAnyChanged)
+		return true;
+
+	TScriptInterface<IStageAPIEditor> ScriptAPI;
+	UStageAPIBlueprintFunctionLibrary::GetAPI(ScriptAPI);
+	IStageAPIEditor& API = *ScriptAPI.GetInterface();
+
+	API.BeginBatch(TEXT("Stage DMX Input"));
+	for (EStageAPIProperty Property : TEnumRange<EStageAPIProperty>())
+	{
+		uint8 const PropertyIndex = static_cast<uint8>(Property);
+		uint8 const ComponentMask = ComponentMasks[PropertyIndex];
+		if (ComponentMask == 0)
+			continue;
+
+		//Components not driven by a changed channel keep their current value
+		FVector4 Value = API.GetPropertyValue(Property);
+		for (int32 Component = 0; Component < 4; ++Component)
+		{
+			if (ComponentMask & (1 << Component))
+			{
+				Value[Component] = Values[PropertyIndex][Component];
+			}
+		}
+		API.SetPropertyValue(Property, Value);
+	}
+	API.FlushPendingWrites();
+	API.CommitBatch();
+	return true;
+}
@@ -0,0 +1,114 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Interfaces/IPv4/IPv4Endpoint.h"
+#include "API/StageAPITypes.h"
+
+class FSocket;
+class FUdpSocketReceiver;
+class FArrayReader;
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+// DMX INPUT
+//
+//Art-Net (ArtDmx, UDP 6454) or sACN / E1.31 (UDP 5568, multicast 239.255.<hi>.<lo> per universe). Universe numbers
+//are the protocol's own: Art-Net port addresses start at 0, sACN universes at 1. Channels are 1-based.
+//
+//A mapping drives one component of a property from one channel, or from a coarse/fine channel pair for 16 bits,
+//scaled linearly from 0..255 (0..65535) to Min..Max.
+//
+//The receiver thread only keeps the latest 512 slots per universe. Each game thread tick diffs them against the
+//slots applied last frame; only that comparison uses SSE2 where available. Mappings whose channels changed are then
+//decoded one by one, and all affected properties are applied in one batch, one transaction per frame.
+//
+//The first frame of each universe after StartListening only seeds that baseline, so nothing is applied until a
+//channel moves. No mappings exist by default: they come from StageAPI.Dmx.Map, or StageAPI.Dmx.Patch for the
+//default fixture layout.
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+enum class EStageAPIDmxProtocol : uint8
+{
+	ArtNet,
+	Sacn,
+};
+
+struct FStageAPIDmxMapping
+{
+	uint16 Universe = 0;
+	//1-based, the coarse channel for 16 bit mappings. The fine channel follows it
+	uint16 Channel = 1;
+	bool b16Bit = false;
+	EStageAPIProperty Property = EStageAPIProperty::None;
+	//Which FVector4 component of the property the channel drives
+	uint8 Component = 0;
+	float Min = 0.0f;
+	float Max = 1.0f;
+};
+
+/**
+ * Optional DMX input treating stage exposure, focus and grades as fixtures on a lighting desk.
+ */
+class FStageAPIDmxInput
+{
+public:
+
+	static constexpr int32 UniverseSize = 512;
+	static constexpr uint16 ArtNetPort = 6454;
+	static constexpr uint16 SacnPort = 5568;
+
+	FStageAPIDmxInput();
+	~FStageAPIDmxInput();
+
+	//Binds the UDP socket and starts receiving. Returns false if the endpoint could not be bound
+	bool StartListening(EStageAPIDmxProtocol InProtocol, const FIPv4Address& BindAddress);
+	void StopListening();
+	bool IsListening() const { return Receiver != nullptr; }
+
+	void AddMapping(const FStageAPIDmxMapping& Mapping);
+	void ClearMappings();
+	const TArray<FStageAPIDmxMapping>& GetMappings() const { return Mappings; }
+
+	//Patches the default fixture layout into a universe starting at channel 1, all 16 bit. Never applied implicitly:
+	//	1 Stage exposure, 3 Frustum exposure, 5 Frustum focal distance, 7 Frustum aperture,
+	//	9 Cluster grade, 73 Frustum grade. Each grade is Saturation, Contrast, Gamma, Gain, Offset,
+	//	Shadows, Mids, Highlights gain, each as R G B Y
+	void AddDefaultPatch(uint16 Universe);
+
+private:
+
+	struct FUniverseSlots
+	{
+		uint8 Channels[UniverseSize];
+		bool bDirty = false;
+	};
+
+	struct FAppliedUniverse
+	{
+		uint8 Channels[UniverseSize];
+		bool bValid = false;
+	};
+
+	//Receiver thread
+	void HandlePacket(const TSharedPtr<FArrayReader, ESPMode::ThreadSafe>& Data, const FIPv4Endpoint& Sender);
+	void StoreUniverse(uint16 Universe, const uint8* Slots, int32 SlotCount);
+
+	//Game thread
+	bool Tick(float DeltaTime);
+	void JoinUniverseGroup(uint16 Universe);
+
+	EStageAPIDmxProtocol Protocol = EStageAPIDmxProtocol::ArtNet;
+	FSocket* Socket = nullptr;
+	FUdpSocketReceiver* Receiver = nullptr;
+
+	//Latest slots per universe, written by the receiver thread
+	FCriticalSection ReceivedLock;
+	TMap<uint16, FUniverseSlots> ReceivedUniverses;
+
+	//Game thread only
+	TArray<FStageAPIDmxMapping> Mappings;
+	TMap<uint16, FAppliedUniverse> AppliedUniverses;
+	TSet<uint16> JoinedUniverses;
+
+	FTSTicker::FDelegateHandle TickerHandle;
+};
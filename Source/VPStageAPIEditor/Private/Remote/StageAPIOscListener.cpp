@@ -0,0 +1,400 @@
+#include "StageAPIOscListener.h"
+#include "VPStageAPIEditorModule.h"
+#include "StageAPIBlueprintFunctionLibrary.h"
+#include "API/IStageAPIEditor.h"
+#include "Common/UdpSocketBuilder.h"
+#include "Common/UdpSocketReceiver.h"
+#include "Sockets.h"
+#include "SocketSubsystem.h"
+
+//Nested bundles deeper than this are rejected
+static constexpr int32 OscMaxBundleDepth = 8;
+
+static uint32 s_ReadOscUInt32(const uint8* Data)
+{
+	return (uint32(Data[0]) << 24) | (uint32(Data[1]) << 16) | (uint32(Data[2]) << 8) | uint32(Data[3]);
+}
+
+static uint64 s_ReadOscUInt64(const uint8* Data)
+{
+	return (uint64(s_ReadOscUInt32(Data)) << 32) | s_ReadOscUInt32(Data + 4);
+}
+
+//Length of a null terminated OSC string including its padding to 4 bytes, or INDEX_NONE if it runs past the end
+static int32 s_GetOscStringSize(const uint8* Data, int32 Size)
+{
+	for (int32 Idx = 0; Idx < Size; ++Idx)
+	{
+		if (Data[Idx] == 0)
+		{
+			int32 const PaddedSize = (Idx + 4) & ~3;
+			return PaddedSize <= Size ? PaddedSize : INDEX_NONE;
+		}
+	}
+	return INDEX_NONE;
+}
+
+FStageAPIOscListener::FStageAPIOscListener()
+{
+	ResetAddressMappings();
+}
+
+FStageAPIOscListener::~FStageAPIOscListener()
+{
+	StopListening();
+}
+
+bool FStageAPIOscListener::StartListening(const FIPv4Endpoint& InEndpoint)
+{
+	if (IsListening())
+		return false;
+
+	//A large receive buffer so bursts from a 100+ Hz console survive a long editor frame
+	Socket = FUdpSocketBuilder(TEXT("StageAPIOsc"))
+		.AsNonBlocking()
+		.AsReusable()
+		.BoundToEndpoint(InEndpoint)
+		.WithReceiveBufferSize(2 * 1024 * 1024)
+		.Build();
+
+	if (!Socket)
+	{
+		UE_LOG(StageAPIEditor, Error, TEXT("VP Stage API OSC listener could not bind %s"), *InEndpoint.ToString());
+		return false;
+	}
+
+	Receiver = new FUdpSocketReceiver(Socket, FTimespan::FromMilliseconds(10), TEXT("StageAPIOscReceiver"));
+	Receiver->OnDataReceived().BindRaw(this, &FStageAPIOscListener::HandlePacket);
+	Receiver->Start();
+
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FStageAPIOscListener::Tick));
+
+	UE_LOG(StageAPIEditor, Log, TEXT("VP Stage API OSC listener on %s"), *InEndpoint.ToString());
+	return true;
+}
+
+void FStageAPIOscListener::StopListening()
+{
+	if (!IsListening())
+		return;
+
+	FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+	TickerHandle.Reset();
+
+	//Stops and joins the receiver thread
+	delete Receiver;
+	Receiver = nullptr;
+
+	ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(Socket);
+	Socket = nullptr;
+
+	PendingPackets.Empty();
+}
+
+void FStageAPIOscListener::SetAddressMapping(const FString& Address, EStageAPIProperty Property)
+{
+	FWriteScopeLock WriteLock(MappingLock);
+	AddressMappings.Add(Address, Property);
+}
+
+void FStageAPIOscListener::RemoveAddressMapping(const FString& Address)
+{
+	FWriteScopeLock WriteLock(MappingLock);
+	AddressMappings.Remove(Address);
+}
+
+void FStageAPIOscListener::ResetAddressMappings()
+{
+	FWriteScopeLock WriteLock(MappingLock);
+	AddressMappings.Reset();
+
+	AddressMappings.Add(TEXT("/stage/position"), EStageAPIProperty::StagePosition);
+	AddressMappings.Add(TEXT("/stage/rotation"), EStageAPIProperty::StageRotation);
+	AddressMappings.Add(TEXT("/stage/defaultview"), EStageAPIProperty::DefaultViewPosition);
+	AddressMappings.Add(TEXT("/stage/exposure"), EStageAPIProperty::StageExposure);
+	AddressMappings.Add(TEXT("/stage/screenpercentage"), EStageAPIProperty::GlobalScreenPercentage);
+	AddressMappings.Add(TEXT("/stage/innerfrustum"), EStageAPIProperty::InnerFrustumEnabled);
+	AddressMappings.Add(TEXT("/stage/chromakey"), EStageAPIProperty::ChromakeyEnabled);
+
+	AddressMappings.Add(TEXT("/stage/frustum/fov"), EStageAPIProperty::FrustumFOVMult);
+	AddressMappings.Add(TEXT("/stage/frustum/exposure"), EStageAPIProperty::FrustumExposure);
+	AddressMappings.Add(TEXT("/stage/frustum/aperture"), EStageAPIProperty::FrustumAperture);
+	AddressMappings.Add(TEXT("/stage/frustum/focus"), EStageAPIProperty::FrustumFocalDistance);
+	AddressMappings.Add(TEXT("/stage/frustum/position"), EStageAPIProperty::FrustumPosition);
+	AddressMappings.Add(TEXT("/stage/frustum/rotation"), EStageAPIProperty::FrustumRotation);
+	AddressMappings.Add(TEXT("/stage/frustum/renderratio"), EStageAPIProperty::FrustumRenderRatio);
+
+	AddressMappings.Add(TEXT("/stage/frustumb/fov"), EStageAPIProperty::FrustumFOVMultB);
+	AddressMappings.Add(TEXT("/stage/frustumb/exposure"), EStageAPIProperty::FrustumExposureB);
+	AddressMappings.Add(TEXT("/stage/frustumb/aperture"), EStageAPIProperty::FrustumApertureB);
+	AddressMappings.Add(TEXT("/stage/frustumb/focus"), EStageAPIProperty::FrustumFocalDistanceB);
+	AddressMappings.Add(TEXT("/stage/frustumb/position"), EStageAPIProperty::FrustumPositionB);
+	AddressMappings.Add(TEXT("/stage/frustumb/rotation"), EStageAPIProperty::FrustumRotationB);
+
+	AddressMappings.Add(TEXT("/stage/cluster/grade/saturation"), EStageAPIProperty::ClusterGlobalSaturation);
+	AddressMappings.Add(TEXT("/stage/cluster/grade/contrast"), EStageAPIProperty::ClusterGlobalContrast);
+	AddressMappings.Add(TEXT("/stage/cluster/grade/gamma"), EStageAPIProperty::ClusterGlobalGamma);
+	AddressMappings.Add(TEXT("/stage/cluster/grade/gain"), EStageAPIProperty::ClusterGlobalGain);
+	AddressMappings.Add(TEXT("/stage/cluster/grade/offset"), EStageAPIProperty::ClusterGlobalOffset);
+	AddressMappings.Add(TEXT("/stage/cluster/grade/shadowsgain"), EStageAPIProperty::ClusterShadowsGain);
+	AddressMappings.Add(TEXT("/stage/cluster/grade/midsgain"), EStageAPIProperty::ClusterMidsGain);
+	AddressMappings.Add(TEXT("/stage/cluster/grade/highlightsgain"), EStageAPIProperty::ClusterHighlightsGain);
+
+	AddressMappings.Add(TEXT("/stage/frustum/grade/saturation"), EStageAPIProperty::FrustumGlobalSaturation);
+	AddressMappings.Add(TEXT("/stage/frustum/grade/contrast"), EStageAPIProperty::FrustumGlobalContrast);
+	AddressMappings.Add(TEXT("/stage/frustum/grade/gamma"), EStageAPIProperty::FrustumGlobalGamma);
+	AddressMappings.Add(TEXT("/stage/frustum/grade/gain"), EStageAPIProperty::FrustumGlobalGain);
+	AddressMappings.Add(TEXT("/stage/frustum/grade/offset"), EStageAPIProperty::FrustumGlobalOffset);
+	AddressMappings.Add(TEXT("/stage/frustum/grade/shadowsgain"), EStageAPIProperty::FrustumShadowsGain);
+	AddressMappings.Add(TEXT("/stage/frustum/grade/midsgain"), EStageAPIProperty::FrustumMidsGain);
+	AddressMappings.Add(TEXT("/stage/frustum/grade/highlightsgain"), EStageAPIProperty::FrustumHighlightsGain);
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+// Receiver thread
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+void FStageAPIOscListener::HandlePacket(const TSharedPtr<FArrayReader, ESPMode::ThreadSafe>& Data, const FIPv4Endpoint& Sender)
+{
+	FOscPacket Packet;
+	if (!ParseElement(Data->GetData(), Data->Num(), Packet, 0))
+	{
+		UE_LOG(StageAPIEditor, Verbose, TEXT("VP Stage API OSC dropped a malformed packet from %s"), *Sender.ToString());
+		return;
+	}
+
+	if (Packet.Num() > 0)
+	{
+		PendingPackets.Enqueue(MoveTemp(Packet));
+	}
+}
+
+bool FStageAPIOscListener::ParseElement(const uint8* Data, int32 Size, FOscPacket& OutPacket, int32 Depth) const
+{
+	static const uint8 BundleTag[8] = { '#', 'b', 'u', 'n', 'd', 'l', 'e', 0 };
+
+	if (Size < 4 || (Size & 3) != 0)
+		return false;
+
+	if (Data[0] != '#')
+		return ParseMessage(Data, Size, OutPacket);
+
+	//Bundle: tag, 64 bit time tag, then size prefixed elements. The time tag is ignored, bundles apply on arrival
+	if (Depth >= OscMaxBundleDepth || Size < 16 || FMemory::Memcmp(Data, BundleTag, sizeof(BundleTag)) != 0)
+		return false;
+
+	int32 Offset = 16;
+	while (Offset < Size)
+	{
+		if (Size - Offset < 4)
+			return false;
+
+		int32 const ElementSize = static_cast<int32>(s_ReadOscUInt32(Data + Offset));
+		Offset += 4;
+		if (ElementSize <= 0 || ElementSize > Size - Offset)
+			return false;
+
+		if (!ParseElement(Data + Offset, ElementSize, OutPacket, Depth + 1))
+			return false;
+
+		Offset += ElementSize;
+	}
+	return true;
+}
+
+bool FStageAPIOscListener::ParseMessage(const uint8* Data, int32 Size, FOscPacket& OutPacket) const
+{
+	int32 const AddressSize = s_GetOscStringSize(Data, Size);
+	if (AddressSize == INDEX_NONE || Data[0] != '/')
+		return false;
+
+	FString Address(ANSI_TO_TCHAR(reinterpret_cast<const ANSICHAR*>(Data)));
+
+	//Messages without a type tag string are allowed by OSC 1.0 but carry no usable arguments
+	if (AddressSize == Size)
+		return true;
+
+	const uint8* TypeTags = Data + AddressSize;
+	int32 const TypeTagSize = s_GetOscStringSize(TypeTags, Size - AddressSize);
+	if (TypeTagSize == INDEX_NONE || TypeTags[0] != ',')
+		return false;
+
+	//Resolve the address, with an optional component suffix
+	FOscValue Value;
+	int32 FirstComponent = 0;
+	{
+		FReadScopeLock ReadLock(MappingLock);
+		if (const EStageAPIProperty* Property = AddressMappings.Find(Address))
+		{
+			Value.Property = *Property;
+		}
+		else if (Address.Len() > 2 && Address[Address.Len() - 2] == TEXT('/'))
+		{
+			int32 const ComponentIndex = FString(TEXT("xyzw")).Find(FString::Chr(Address[Address.Len() - 1]), ESearchCase::IgnoreCase);
+			const EStageAPIProperty* Property = ComponentIndex != INDEX_NONE ? AddressMappings.Find(Address.LeftChop(2)) : nullptr;
+			if (Property)
+			{
+				Value.Property = *Property;
+				FirstComponent = ComponentIndex;
+			}
+		}
+	}
+
+	const uint8* Argument = TypeTags + TypeTagSize;
+	const uint8* const End = Data + Size;
+	int32 Component = FirstComponent;
+
+	for (const uint8* TypeTag = TypeTags + 1; *TypeTag; ++TypeTag)
+	{
+		double NumericValue = 0.0;
+		bool bNumeric = true;
+		int32 ArgumentSize = 0;
+
+		switch (*TypeTag)
+		{
+		case 'f':
+		{
+			ArgumentSize = 4;
+			if (End - Argument < ArgumentSize)
+				return false;
+			uint32 const Bits = s_ReadOscUInt32(Argument);
+			float FloatValue;
+			FMemory::Memcpy(&FloatValue, &Bits, sizeof(float));
+			NumericValue = FloatValue;
+			break;
+		}
+		case 'i':
+			ArgumentSize = 4;
+			if (End - Argument < ArgumentSize)
+				return false;
+			NumericValue = static_cast<int32>(s_ReadOscUInt32(Argument));
+			break;
+		case 'd':
+		{
+			ArgumentSize = 8;
+			if (End - Argument < ArgumentSize)
+				return false;
+			uint64 const Bits = s_ReadOscUInt64(Argument);
+			FMemory::Memcpy(&NumericValue, &Bits, sizeof(double));
+			break;
+		}
+		case 'h':
+			ArgumentSize = 8;
+			if (End - Argument < ArgumentSize)
+				return false;
+			NumericValue = static_cast<double>(static_cast<int64>(s_ReadOscUInt64(Argument)));
+			break;
+		case 'T':
+			NumericValue = 1.0;
+			break;
+		case 'F':
+			NumericValue = 0.0;
+			break;
+		case 's':
+		case 'S':
+			bNumeric = false;
+			ArgumentSize = s_GetOscStringSize(Argument, static_cast<int32>(End - Argument));
+			if (ArgumentSize == INDEX_NONE)
+				return false;
+			break;
+		case 'b':
+			bNumeric = false;
+			if (End - Argument < 4)
+				return false;
+			ArgumentSize = 4 + ((static_cast<int32>(s_ReadOscUInt32(Argument)) + 3) & ~3);
+			if (ArgumentSize < 4 || End - Argument < ArgumentSize)
+				return false;
+			break;
+		case 't':
+			bNumeric = false;
+			ArgumentSize = 8;
+			if (End - Argument < ArgumentSize)
+				return false;
+			break;
+		case 'N':
+		case 'I':
+			bNumeric = false;
+			break;
+		default:
+			//Unknown types have unknown sizes, the rest of the message cannot be read
+			return false;
+		}
+
+		Argument += ArgumentSize;
+
+		//NaN, infinity and doubles beyond float range would end up in the stage, the whole packet is dropped
+		if (bNumeric && !FMath::IsFinite(static_cast<float>(NumericValue)))
+			return false;
+
+		if (bNumeric && Component < 4)
+		{
+			Value.Value[Component] = NumericValue;
+			Value.ComponentMask |= 1 << Component;
+			++Component;
+		}
+	}
+
+	//Unmapped addresses are parsed for validity and ignored
+	if (Value.Property != EStageAPIProperty::None && Value.ComponentMask != 0)
+	{
+		OutPacket.Add(Value);
+	}
+	return true;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+// Game thread
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+bool FStageAPIOscListener::Tick(float DeltaTime)
+{
+	if (PendingPackets.IsEmpty())
+		return true;
+
+	//Collapse everything received since the last tick to the latest value per property and component
+	FOscPacket Packet;
+	while (PendingPackets.Dequeue(Packet))
+	{
+		for (const FOscValue& Value : Packet)
+		{
+			uint8 const PropertyIndex = static_cast<uint8>(Value.Property);
+			for (int32 Component = 0; Component < 4; ++Component)
+			{
+				if (Value.ComponentMask & (1 << Component))
+				{
+					FrameValues[PropertyIndex][Component] = Value.Value[Component];
+				}
+			}
+			FrameComponentMasks[PropertyIndex] |= Value.ComponentMask;
+		}
+	}
+
+	TScriptInterface<IStageAPIEditor> ScriptAPI;
+	UStageAPIBlueprintFunctionLibrary::GetAPI(ScriptAPI);
+	IStageAPIEditor& API = *ScriptAPI.GetInterface();
+
+	API.BeginBatch(TEXT("Stage OSC Input"));
+	for (EStageAPIProperty Property : TEnumRange<EStageAPIProperty>())
+	{
+		uint8 const PropertyIndex = static_cast<uint8>(Property);
+		uint8 const ComponentMask = FrameComponentMasks[PropertyIndex];
+		if (ComponentMask == 0)
+			continue;
+
+		//Components that were not received keep their current value
+		FVector4 Value = ComponentMask == 0xF ? FrameValues[PropertyIndex] : API.GetPropertyValue(Property);
+		for (int32 Component = 0; Component < 4 && ComponentMask != 0xF; ++Component)
+		{
+			if (ComponentMask & (1 << Component))
+			{
+				Value[Component] = FrameValues[PropertyIndex][Component];
+			}
+		}
+
+		API.SetPropertyValue(Property, Value);
+		FrameComponentMasks[PropertyIndex] = 0;
+	}
+	API.FlushPendingWrites();
+	API.CommitBatch();
+	return true;
+}
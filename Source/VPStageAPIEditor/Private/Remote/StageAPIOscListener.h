@@ -0,0 +1,91 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Queue.h"
+#include "Containers/Ticker.h"
+#include "Interfaces/IPv4/IPv4Endpoint.h"
+#include "Misc/ScopeRWLock.h"
+#include "API/StageAPITypes.h"
+
+class FSocket;
+class FUdpSocketReceiver;
+class FArrayReader;
+
+//Common OSC console default
+static constexpr uint16 StageAPIOscDefaultPort = 8000;
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+// OSC INPUT
+//
+//UDP OSC 1.0 messages and bundles. Each address maps to a Stage API property, the message arguments (float, int,
+//double, bool) fill the property's FVector4 layout in order. A trailing /x /y /z or /w on a mapped address sets a
+//single component, e.g. /stage/frustum/position/z. Default mappings:
+//	/stage/position /stage/rotation /stage/defaultview /stage/exposure /stage/screenpercentage
+//	/stage/innerfrustum /stage/chromakey
+//	/stage/frustum/{fov,exposure,aperture,focus,position,rotation,renderratio}
+//	/stage/frustumb/{fov,exposure,aperture,focus,position,rotation}
+//	/stage/{cluster,frustum}/grade/{saturation,contrast,gamma,gain,offset,shadowsgain,midsgain,highlightsgain}
+//
+//Packets are parsed on the receiver thread. A packet (a bundle including nested bundles, or a lone message) is
+//queued as one unit, so a bundle is never split across frames. On the game thread everything received since the
+//last tick collapses to the latest value per property and is applied in one batch.
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Optional OSC listener driving the Stage API from lighting and camera consoles. Receiving and parsing run on the
+ * UDP receiver thread, only the collapsed per-frame values are applied on the game thread.
+ */
+class FStageAPIOscListener
+{
+public:
+
+	FStageAPIOscListener();
+	~FStageAPIOscListener();
+
+	//Binds the UDP socket and starts receiving. Returns false if the endpoint could not be bound
+	bool StartListening(const FIPv4Endpoint& InEndpoint);
+	void StopListening();
+	bool IsListening() const { return Receiver != nullptr; }
+
+	//Maps an OSC address to a property, replacing an existing mapping for that address
+	void SetAddressMapping(const FString& Address, EStageAPIProperty Property);
+	void RemoveAddressMapping(const FString& Address);
+	void ResetAddressMappings();
+
+private:
+
+	struct FOscValue
+	{
+		EStageAPIProperty Property = EStageAPIProperty::None;
+		//Bit N set when component N of Value was received
+		uint8 ComponentMask = 0;
+		FVector4 Value = FVector4(0, 0, 0, 0);
+	};
+
+	//All values of one packet
+	typedef TArray<FOscValue, TInlineAllocator<8>> FOscPacket;
+
+	//Receiver thread
+	void HandlePacket(const TSharedPtr<FArrayReader, ESPMode::ThreadSafe>& Data, const FIPv4Endpoint& Sender);
+	bool ParseElement(const uint8* Data, int32 Size, FOscPacket& OutPacket, int32 Depth) const;
+	bool ParseMessage(const uint8* Data, int32 Size, FOscPacket& OutPacket) const;
+
+	//Game thread
+	bool Tick(float DeltaTime);
+
+	FSocket* Socket = nullptr;
+	FUdpSocketReceiver* Receiver = nullptr;
+
+	//Address -> property, read on the receiver thread
+	mutable FRWLock MappingLock;
+	TMap<FString, EStageAPIProperty> AddressMappings;
+
+	//Receiver thread -> game thread
+	TQueue<FOscPacket, EQueueMode::Spsc> PendingPackets;
+
+	//Latest value per property for the current frame
+	FVector4 FrameValues[static_cast<uint8>(EStageAPIProperty::Count)];
+	uint8 FrameComponentMasks[static_cast<uint8>(EStageAPIProperty::Count)] = {};
+
+	FTSTicker::FDelegateHandle TickerHandle;
+};
@@ -0,0 +1,657 @@
+#include "StageAPIRemoteServer.h"
+#include "VPStageAPIEditorModule.h"
+#include "StageAPIBlueprintFunctionLibrary.h"
+#include "API/IStageAPIEditor.h"
+#include "Common/TcpSocketBuilder.h"
+#include "HAL/Event.h"
+#include "HAL/RunnableThread.h"
+#include "Misc/AutomationTest.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Sockets.h"
+#include "SocketSubsystem.h"
+
+using namespace StageAPIRemote;
+
+//Reads a uint16 length prefixed UTF-8 string
+static bool s_ReadRemoteString(FArchive& Ar, FString& OutString)
+{
+	uint16 Length = 0;
+	Ar << Length;
+	if (Ar.IsError() || Ar.Tell() + Length > Ar.TotalSize())
+		return false;
+
+	TArray<ANSICHAR> Utf8;
+	Utf8.SetNumUninitialized(Length);
+	Ar.Serialize(Utf8.GetData(), Length);
+
+	FUTF8ToTCHAR Converted(Utf8.GetData(), Length);
+	OutString = FString(Converted.Length(), Converted.Get());
+	return !Ar.IsError();
+}
+
+static void s_SerializeRemoteVector(FArchive& Ar, FVector4& Value)
+{
+	FVector4f WireValue(Value);
+	Ar << WireValue.X << WireValue.Y << WireValue.Z << WireValue.W;
+	Value = FVector4(WireValue);
+}
+
+//NaN or infinity would be written straight into the stage
+static bool s_IsFiniteRemoteVector(const FVector4& Value)
+{
+	return FMath::IsFinite(Value.X) && FMath::IsFinite(Value.Y) && FMath::IsFinite(Value.Z) && FMath::IsFinite(Value.W);
+}
+
+FStageAPIRemoteServer::FStageAPIRemoteServer()
+{
+	WakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+}
+
+FStageAPIRemoteServer::~FStageAPIRemoteServer()
+{
+	StopServer();
+	FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+	WakeEvent = nullptr;
+}
+
+bool FStageAPIRemoteServer::StartServer(const FIPv4Endpoint& InEndpoint)
+{
+	if (IsRunning())
+		return false;
+
+	ListenSocket = FTcpSocketBuilder(TEXT("StageAPIRemoteListener"))
+		.AsNonBlocking()
+		.AsReusable()
+		.BoundToEndpoint(InEndpoint)
+		.Listening(8)
+		.Build();
+
+	if (!ListenSocket)
+	{
+		UE_LOG(StageAPIEditor, Error, TEXT("VP Stage API remote server could not listen on %s"), *InEndpoint.ToString());
+		return false;
+	}
+
+	Endpoint = FIPv4Endpoint(InEndpoint.Address, ListenSocket->GetPortNo());
+	bStopping = false;
+	Thread = FRunnableThread::Create(this, TEXT("StageAPIRemoteServer"), 0, TPri_BelowNormal);
+	if (!Thread)
+	{
+		UE_LOG(StageAPIEditor, Error, TEXT("VP Stage API remote server could not start its worker thread"));
+		ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(ListenSocket);
+		ListenSocket = nullptr;
+		return false;
+	}
+
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FStageAPIRemoteServer::Tick));
+
+	UE_LOG(StageAPIEditor, Log, TEXT("VP Stage API remote server listening on %s"), *Endpoint.ToString());
+	return true;
+}
+
+void FStageAPIRemoteServer::StopServer()
+{
+	if (!IsRunning())
+		return;
+
+	FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+	TickerHandle.Reset();
+
+	//The worker owns the client sockets and closes them on the way out
+	Thread->Kill(true);
+	delete Thread;
+	Thread = nullptr;
+
+	ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(ListenSocket);
+	ListenSocket = nullptr;
+
+	PendingCommands.Empty();
+	PendingReplies.Empty();
+
+	UE_LOG(StageAPIEditor, Log, TEXT("VP Stage API remote server stopped"));
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+// Worker thread
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+void FStageAPIRemoteServer::Stop()
+{
+	bStopping = true;
+	WakeEvent->Trigger();
+}
+
+uint32 FStageAPIRemoteServer::Run()
+{
+	while (!bStopping)
+	{
+		AcceptClients();
+
+		//Replies from the game thread go to the client's send buffer
+		FReply Reply;
+		while (PendingReplies.Dequeue(Reply))
+		{
+			if (FClient* Client = Clients.Find(Reply.ClientId))
+			{
+				Client->SendBuffer.Append(Reply.Bytes);
+			}
+		}
+
+		for (auto ClientIt = Clients.CreateIterator(); ClientIt; ++ClientIt)
+		{
+			if (!ReceiveFromClient(ClientIt.Key(), ClientIt.Value()) || !SendToClient(ClientIt.Value()))
+			{
+				CloseClient(ClientIt.Value());
+				ClientIt.RemoveCurrent();
+			}
+		}
+
+		//Sockets are non-blocking. Without clients block on the listener, with clients sleep until a reply is queued
+		//or the poll interval has passed
+		if (Clients.Num() == 0)
+		{
+			ListenSocket->Wait(ESocketWaitConditions::WaitForRead, FTimespan::FromMilliseconds(50));
+		}
+		else
+		{
+			WakeEvent->Wait(FTimespan::FromMilliseconds(ClientPollIntervalMs));
+		}
+	}
+
+	for (TPair<uint32, FClient>& Client : Clients)
+	{
+		CloseClient(Client.Value);
+	}
+	Clients.Reset();
+	return 0;
+}
+
+void FStageAPIRemoteServer::AcceptClients()
+{
+	bool bPendingConnection = false;
+	while (ListenSocket->HasPendingConnection(bPendingConnection) && bPendingConnection)
+	{
+		FSocket* Socket = ListenSocket->Accept(TEXT("StageAPIRemoteClient"));
+		if (!Socket)
+			break;
+
+		Socket->SetNonBlocking(true);
+		Socket->SetNoDelay(true);
+
+		FClient& Client = Clients.Add(NextClientId++);
+		Client.Socket = Socket;
+	}
+}
+
+/**
+ * @brief Reads what is available and queues every complete message. Returns false when the client disconnected or
+ * sent a malformed message.
+ */
+bool FStageAPIRemoteServer::ReceiveFromClient(uint32 ClientId, FClient& Client)
+{
+	uint32 PendingSize = 0;
+	while (Client.Socket->HasPendingData(PendingSize) && PendingSize > 0)
+	{
+		//Complete messages are taken out after every read, so only a partial message is ever left in the buffer
+		int32 const Offset = Client.ReceiveBuffer.Num();
+		int32 const ReadSize = FMath::Min(static_cast<int32>(PendingSize), static_cast<int32>(MaxReceiveBufferSize) - Offset);
+		if (ReadSize <= 0)
+		{
+			UE_LOG(StageAPIEditor, Warning, TEXT("VP Stage API remote client %u overflowed its receive buffer, disconnecting"), ClientId);
+			return false;
+		}
+
+		Client.ReceiveBuffer.AddUninitialized(ReadSize);
+
+		int32 BytesRead = 0;
+		if (!Client.Socket->Recv(Client.ReceiveBuffer.GetData() + Offset, ReadSize, BytesRead))
+			return false;
+
+		//A readable socket with nothing to read is an orderly shutdown from the client
+		if (BytesRead == 0)
+			return false;
+
+		Client.ReceiveBuffer.SetNum(Offset + BytesRead, false);
+		if (!ProcessReceiveBuffer(ClientId, Client))
+			return false;
+	}
+
+	//A closed connection reports as readable with no data
+	return Client.Socket->GetConnectionState() == SCS_Connected;
+}
+
+//Queues every complete message in the receive buffer and drops them from it
+bool FStageAPIRemoteServer::ProcessReceiveBuffer(uint32 ClientId, FClient& Client)
+{
+	int32 ReadOffset = 0;
+	while (Client.ReceiveBuffer.Num() - ReadOffset >= static_cast<int32>(sizeof(uint32)))
+	{
+		uint32 PayloadSize = 0;
+		FMemory::Memcpy(&PayloadSize, Client.ReceiveBuffer.GetData() + ReadOffset, sizeof(uint32));
+		if (PayloadSize > MaxPayloadSize)
+		{
+			UE_LOG(StageAPIEditor, Warning, TEXT("VP Stage API remote client %u sent a %u byte message, disconnecting"), ClientId, PayloadSize);
+			return false;
+		}
+
+		if (Client.ReceiveBuffer.Num() - ReadOffset - static_cast<int32>(sizeof(uint32)) < static_cast<int32>(PayloadSize))
+			break;
+
+		FCommand Command;
+		if (!DecodeCommand(ClientId, Client.ReceiveBuffer.GetData() + ReadOffset + sizeof(uint32), PayloadSize, Command))
+		{
+			UE_LOG(StageAPIEditor, Warning, TEXT("VP Stage API remote client %u sent a malformed message, disconnecting"), ClientId);
+			return false;
+		}
+		PendingCommands.Enqueue(MoveTemp(Command));
+
+		ReadOffset += sizeof(uint32) + PayloadSize;
+	}
+
+	if (ReadOffset > 0)
+	{
+		Client.ReceiveBuffer.RemoveAt(0, ReadOffset, EAllowShrinking::No);
+	}
+	return true;
+}
+
+/**
+ * @brief Sends as much of the send buffer as the socket takes, the rest waits for the next pass. Returns false on a
+ * socket error or when a client stopped reading and its backlog grew past MaxSendBufferSize.
+ */
+bool FStageAPIRemoteServer::SendToClient(FClient& Client)
+{
+	if (Client.SendBuffer.Num() == 0)
+		return true;
+
+	int32 BytesSent = 0;
+	if (!Client.Socket->Send(Client.SendBuffer.GetData(), Client.SendBuffer.Num(), BytesSent))
+	{
+		//The socket's own buffer is full, nothing was sent
+		return ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->GetLastErrorCode() == SE_EWOULDBLOCK
+			&& Client.SendBuffer.Num() <= static_cast<int32>(MaxSendBufferSize);
+	}
+
+	if (BytesSent > 0)
+	{
+		Client.SendBuffer.RemoveAt(0, BytesSent, EAllowShrinking::No);
+	}
+	return Client.SendBuffer.Num() <= static_cast<int32>(MaxSendBufferSize);
+}
+
+bool FStageAPIRemoteServer::DecodeCommand(uint32 ClientId, const uint8* Payload, uint32 PayloadSize, FCommand& OutCommand) const
+{
+	TArray<uint8> Bytes(Payload, PayloadSize);
+	FMemoryReader Reader(Bytes);
+
+	uint8 Opcode = 0;
+	Reader << Opcode << OutCommand.RequestId;
+	OutCommand.ClientId = ClientId;
+	OutCommand.Opcode = static_cast<EOpcode>(Opcode);
+
+	auto ReadProperty = [&Reader, &OutCommand]()
+	{
+		uint8 Property = 0;
+		Reader << Property;
+		OutCommand.Property = static_cast<EStageAPIProperty>(Property);
+		return Property > static_cast<uint8>(EStageAPIProperty::None) && Property < static_cast<uint8>(EStageAPIProperty::Count);
+	};
+
+	bool bValid = true;
+	switch (OutCommand.Opcode)
+	{
+	case EOpcode::Ping:
+	case EOpcode::SequencerPlay:
+	case EOpcode::SequencerPause:
+		break;
+
+	case EOpcode::SetProperty:
+		bValid = ReadProperty();
+		s_SerializeRemoteVector(Reader, OutCommand.Value);
+		bValid = bValid && s_IsFiniteRemoteVector(OutCommand.Value);
+		break;
+
+	case EOpcode::GetProperty:
+		bValid = ReadProperty();
+		break;
+
+	case EOpcode::RecallPreset:
+	case EOpcode::ApplyRenderTier:
+		bValid = s_ReadRemoteString(Reader, OutCommand.Name);
+		break;
+
+	case EOpcode::StartTransition:
+		bValid = ReadProperty();
+		s_SerializeRemoteVector(Reader, OutCommand.Value);
+		Reader << OutCommand.Duration << OutCommand.Easing;
+		bValid = bValid && s_IsFiniteRemoteVector(OutCommand.Value) && FMath::IsFinite(OutCommand.Duration);
+		//The game thread casts the byte straight to EEasingFunc::Type
+		bValid = bValid && OutCommand.Easing <= static_cast<uint8>(EEasingFunc::CircularInOut);
+		break;
+
+	case EOpcode::SequencerSetFrame:
+		Reader << OutCommand.Frame;
+		break;
+
+	default:
+		//Unknown opcodes get an error reply, the framing is still intact
+		break;
+	}
+
+	return bValid && !Reader.IsError();
+}
+
+void FStageAPIRemoteServer::CloseClient(FClient& Client)
+{
+	if (Client.Socket)
+	{
+		Client.Socket->Close();
+		ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(Client.Socket);
+		Client.Socket = nullptr;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+// Game thread
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+bool FStageAPIRemoteServer::Tick(float DeltaTime)
+{
+	if (PendingCommands.IsEmpty())
+		return true;
+
+	TScriptInterface<IStageAPIEditor> ScriptAPI;
+	UStageAPIBlueprintFunctionLibrary::GetAPI(ScriptAPI);
+	IStageAPIEditor& API = *ScriptAPI.GetInterface();
+
+	//Everything received since the last tick is one transaction
+	API.BeginBatch(TEXT("Stage Remote Control"));
+	FCommand Command;
+	while (PendingCommands.Dequeue(Command))
+	{
+		ExecuteCommand(API, Command);
+	}
+	API.FlushPendingWrites();
+	API.CommitBatch();
+	return true;
+}
+
+void FStageAPIRemoteServer::ExecuteCommand(IStageAPIEditor& API, const FCommand& Command)
+{
+	switch (Command.Opcode)
+	{
+	case EOpcode::Ping:
+		QueueReply(Command, EOpcode::Pong, [](FArchive&) {});
+		break;
+
+	case EOpcode::SetProperty:
+		API.SetPropertyValue(Command.Property, Command.Value);
+		break;
+
+	case EOpcode::GetProperty:
+	{
+		FVector4 Value = API.GetPropertyValue(Command.Property);
+		QueueReply(Command, EOpcode::PropertyValue, [&Command, &Value](FArchive& Ar)
+		{
+			uint8 Property = static_cast<uint8>(Command.Property);
+			Ar << Property;
+			s_SerializeRemoteVector(Ar, Value);
+		});
+		break;
+	}
+
+	case EOpcode::RecallPreset:
+		if (!API.RecallPreset(FName(*Command.Name)))
+		{
+			QueueReply(Command, EOpcode::Error, [&Command](FArchive& Ar) { uint8 Opcode = static_cast<uint8>(Command.Opcode); Ar << Opcode; });
+		}
+		break;
+
+	case EOpcode::ApplyRenderTier:
+		if (!API.ApplyRenderTier(FName(*Command.Name)))
+		{
+			QueueReply(Command, EOpcode::Error, [&Command](FArchive& Ar) { uint8 Opcode = static_cast<uint8>(Command.Opcode); Ar << Opcode; });
+		}
+		break;
+
+	case EOpcode::StartTransition:
+		API.StartTransition(Command.Property, Command.Value, Command.Duration, static_cast<EEasingFunc::Type>(Command.Easing));
+		break;
+
+	case EOpcode::SequencerPlay:
+		API.PlaySequencer();
+		break;
+
+	case EOpcode::SequencerPause:
+		API.PauseSequencer();
+		break;
+
+	case EOpcode::SequencerSetFrame:
+		API.SetSequencerFrame(Command.Frame, EStageAPISequencerTimeBase::DisplayRate);
+		break;
+
+	default:
+		QueueReply(Command, EOpcode::Error, [&Command](FArchive& Ar) { uint8 Opcode = static_cast<uint8>(Command.Opcode); Ar << Opcode; });
+		break;
+	}
+}
+
+void FStageAPIRemoteServer::QueueReply(const FCommand& Command, EOpcode Opcode, TFunctionRef<void(FArchive&)> WriteBody)
+{
+	FReply Reply;
+	Reply.ClientId = Command.ClientId;
+
+	FMemoryWriter Writer(Reply.Bytes);
+	uint32 PayloadSize = 0;
+	uint8 ReplyOpcode = static_cast<uint8>(Opcode);
+	uint32 RequestId = Command.RequestId;
+	Writer << PayloadSize << ReplyOpcode << RequestId;
+	WriteBody(Writer);
+
+	//Patch the length prefix now the body size is known
+	PayloadSize = Reply.Bytes.Num() - sizeof(uint32);
+	FMemory::Memcpy(Reply.Bytes.GetData(), &PayloadSize, sizeof(uint32));
+
+	PendingReplies.Enqueue(MoveTemp(Reply));
+	WakeEvent->Trigger();
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+// Tests
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+//Blocking loopback client speaking the remote protocol, shared by the test steps
+struct FStageAPIRemoteTestState
+{
+	TUniquePtr<FStageAPIRemoteServer> Server;
+	FSocket* Socket = nullptr;
+	TArray<uint8> Received;
+	double Deadline = 0.0;
+	FVector4 OriginalValue = FVector4(0, 0, 0, 0);
+	FVector4 TestValue = FVector4(0, 0, 0, 0);
+	bool bHasStage = false;
+
+	~FStageAPIRemoteTestState()
+	{
+		if (Socket)
+		{
+			Socket->Close();
+			ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(Socket);
+		}
+		if (Server)
+		{
+			Server->StopServer();
+		}
+	}
+
+	void Send(EOpcode Opcode, uint32 RequestId, TFunctionRef<void(FArchive&)> WriteBody)
+	{
+		TArray<uint8> Bytes;
+		FMemoryWriter Writer(Bytes);
+		uint32 PayloadSize = 0;
+		uint8 RawOpcode = static_cast<uint8>(Opcode);
+		Writer << PayloadSize << RawOpcode << RequestId;
+		WriteBody(Writer);
+
+		PayloadSize = Bytes.Num() - sizeof(uint32);
+		FMemory::Memcpy(Bytes.GetData(), &PayloadSize, sizeof(uint32));
+
+		int32 BytesSent = 0;
+		Socket->Send(Bytes.GetData(), Bytes.Num(), BytesSent);
+		Deadline = FPlatformTime::Seconds() + 5.0;
+	}
+
+	//Takes the next complete reply off the socket, false while none has arrived
+	bool Receive(uint8& OutOpcode, uint32& OutRequestId, TArray<uint8>& OutBody)
+	{
+		uint32 PendingSize = 0;
+		while (Socket->HasPendingData(PendingSize) && PendingSize > 0)
+		{
+			int32 const Offset = Received.Num();
+			Received.AddUninitialized(PendingSize);
+			int32 BytesRead = 0;
+			Socket->Recv(Received.GetData() + Offset, PendingSize, BytesRead);
+			Received.SetNum(Offset + BytesRead, false);
+		}
+
+		uint32 PayloadSize = 0;
+		if (Received.Num() < static_cast<int32>(sizeof(uint32)))
+			return false;
+
+		FMemory::Memcpy(&PayloadSize, Received.GetData(), sizeof(uint32));
+		if (Received.Num() < static_cast<int32>(sizeof(uint32) + PayloadSize))
+			return false;
+
+		TArray<uint8> Payload(Received.GetData() + sizeof(uint32), PayloadSize);
+		Received.RemoveAt(0, sizeof(uint32) + PayloadSize, EAllowShrinking::No);
+
+		FMemoryReader Reader(Payload);
+		Reader << OutOpcode << OutRequestId;
+		OutBody = TArray<uint8>(Payload.GetData() + Reader.Tell(), Payload.Num() - Reader.Tell());
+		return !Reader.IsError();
+	}
+};
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FStageAPIRemoteServerTest, "VPStageAPI.RemoteServer",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FStageAPIRemoteServerTest::RunTest(const FString& Parameters)
+{
+	TSharedRef<FStageAPIRemoteTestState> State = MakeShared<FStageAPIRemoteTestState>();
+
+	State->Server = MakeUnique<FStageAPIRemoteServer>();
+	if (!State->Server->StartServer(FIPv4Endpoint(FIPv4Address(127, 0, 0, 1), 0)))
+	{
+		AddError(TEXT("Remote server did not start on loopback"));
+		return false;
+	}
+
+	State->Socket = FTcpSocketBuilder(TEXT("StageAPIRemoteTestClient")).AsBlocking().Build();
+	if (!State->Socket || !State->Socket->Connect(*State->Server->GetEndpoint().ToInternetAddr()))
+	{
+		AddError(TEXT("Could not connect to the remote server"));
+		return false;
+	}
+
+	TScriptInterface<IStageAPIEditor> ScriptAPI;
+	UStageAPIBlueprintFunctionLibrary::GetAPI(ScriptAPI);
+	State->bHasStage = !ScriptAPI->GetActiveRootName().IsNone();
+	if (!State->bHasStage)
+	{
+		AddInfo(TEXT("No nDisplay root in the level, property values are not checked"));
+	}
+
+	EStageAPIProperty const Property = EStageAPIProperty::GlobalScreenPercentage;
+	auto WriteProperty = [Property](FArchive& Ar)
+	{
+		uint8 RawProperty = static_cast<uint8>(Property);
+		Ar << RawProperty;
+	};
+
+	//Waits for the reply to RequestId, commands are applied on the next editor tick
+	auto WaitForReply = [this, State](EOpcode ExpectedOpcode, uint32 RequestId, TFunction<void(FMemoryReader&)> ReadBody)
+	{
+		return [this, State, ExpectedOpcode, RequestId, ReadBody]()
+		{
+			uint8 Opcode = 0;
+			uint32 ReplyId = 0;
+			TArray<uint8> Body;
+			if (!State->Receive(Opcode, ReplyId, Body))
+			{
+				if (FPlatformTime::Seconds() > State->Deadline)
+				{
+					AddError(FString::Printf(TEXT("No reply to request %u"), RequestId));
+					return true;
+				}
+				return false;
+			}
+
+			TestEqual(TEXT("Reply opcode"), static_cast<int32>(Opcode), static_cast<int32>(ExpectedOpcode));
+			TestEqual(TEXT("Reply request id"), static_cast<int32>(ReplyId), static_cast<int32>(RequestId));
+			if (ReadBody)
+			{
+				FMemoryReader Reader(Body);
+				ReadBody(Reader);
+			}
+			return true;
+		};
+	};
+
+	State->Send(EOpcode::Ping, 1, [](FArchive&) {});
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand(WaitForReply(EOpcode::Pong, 1, nullptr)));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([State, WriteProperty]()
+	{
+		State->Send(EOpcode::GetProperty, 2, WriteProperty);
+		return true;
+	}));
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand(WaitForReply(EOpcode::PropertyValue, 2, [this, State, Property](FMemoryReader& Reader)
+	{
+		uint8 RawProperty = 0;
+		Reader << RawProperty;
+		s_SerializeRemoteVector(Reader, State->OriginalValue);
+		TestEqual(TEXT("Property in reply"), static_cast<int32>(RawProperty), static_cast<int32>(Property));
+		State->TestValue = FVector4(State->OriginalValue.X + 0.25f, 0, 0, 0);
+	})));
+
+	//The ping after the set makes sure it has been applied and flushed before the value is read back
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([State, WriteProperty]()
+	{
+		State->Send(EOpcode::SetProperty, 3, [State, WriteProperty](FArchive& Ar) { WriteProperty(Ar); s_SerializeRemoteVector(Ar, State->TestValue); });
+		State->Send(EOpcode::Ping, 4, [](FArchive&) {});
+		return true;
+	}));
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand(WaitForReply(EOpcode::Pong, 4, nullptr)));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([State, WriteProperty]()
+	{
+		State->Send(EOpcode::GetProperty, 5, WriteProperty);
+		return true;
+	}));
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand(WaitForReply(EOpcode::PropertyValue, 5, [this, State](FMemoryReader& Reader)
+	{
+		uint8 RawProperty = 0;
+		FVector4 Value;
+		Reader << RawProperty;
+		s_SerializeRemoteVector(Reader, Value);
+		if (State->bHasStage)
+		{
+			TestEqual(TEXT("Value read back after set"), Value.X, State->TestValue.X, 1e-4);
+		}
+	})));
+
+	//Put the stage back as it was
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([State, WriteProperty]()
+	{
+		State->Send(EOpcode::SetProperty, 6, [State, WriteProperty](FArchive& Ar) { WriteProperty(Ar); s_SerializeRemoteVector(Ar, State->OriginalValue); });
+		State->Send(EOpcode::Ping, 7, [](FArchive&) {});
+		return true;
+	}));
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand(WaitForReply(EOpcode::Pong, 7, nullptr)));
+	return true;
+}
+
+#endif
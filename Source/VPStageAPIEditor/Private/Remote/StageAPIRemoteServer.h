@@ -0,0 +1,153 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include "Containers/Queue.h"
+#include "Containers/Ticker.h"
+#include "Interfaces/IPv4/IPv4Endpoint.h"
+#include "API/StageAPITypes.h"
+#include <atomic>
+
+class FSocket;
+class FEvent;
+class FRunnableThread;
+class IStageAPIEditor;
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+// REMOTE CONTROL PROTOCOL
+//
+//TCP, little endian. Every message is a uint32 payload length followed by the payload:
+//	uint8 Opcode, uint32 RequestId, body
+//
+//Requests (client -> editor)
+//	0x01 Ping				-
+//	0x02 SetProperty		uint8 EStageAPIProperty, float X, Y, Z, W
+//	0x03 GetProperty		uint8 EStageAPIProperty
+//	0x04 RecallPreset		uint16 length + UTF-8 name
+//	0x05 ApplyRenderTier	uint16 length + UTF-8 name
+//	0x06 StartTransition	uint8 EStageAPIProperty, float X, Y, Z, W, float Duration, uint8 EEasingFunc (up to CircularInOut)
+//	0x07 SequencerPlay		-
+//	0x08 SequencerPause		-
+//	0x09 SequencerSetFrame	int32 Frame (display rate)
+//
+//Replies (editor -> client) echo the RequestId with the high bit of the opcode set
+//	0x81 Pong				-
+//	0x83 PropertyValue		uint8 EStageAPIProperty, float X, Y, Z, W
+//	0xFF Error				uint8 request opcode
+//
+//Commands are decoded on the worker thread and applied on the game thread at the next tick. All commands
+//received in the same frame are applied inside one batch, so they form one transaction.
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace StageAPIRemote
+{
+	enum class EOpcode : uint8
+	{
+		Ping = 0x01,
+		SetProperty = 0x02,
+		GetProperty = 0x03,
+		RecallPreset = 0x04,
+		ApplyRenderTier = 0x05,
+		StartTransition = 0x06,
+		SequencerPlay = 0x07,
+		SequencerPause = 0x08,
+		SequencerSetFrame = 0x09,
+
+		Pong = 0x81,
+		PropertyValue = 0x83,
+		Error = 0xFF,
+	};
+
+	//Largest payload accepted, a client sending more is disconnected
+	static constexpr uint32 MaxPayloadSize = 4096;
+	//Largest partial message kept for a client, one length prefix and a full payload
+	static constexpr uint32 MaxReceiveBufferSize = sizeof(uint32) + MaxPayloadSize;
+	//How long the worker sleeps between reads while clients are connected. Replies wake it straight away, and commands
+	//are only applied at the next editor tick anyway
+	static constexpr float ClientPollIntervalMs = 5.0f;
+	//Largest reply backlog kept for a client that is not reading, past it the client is disconnected
+	static constexpr uint32 MaxSendBufferSize = 256 * 1024;
+	static constexpr uint16 DefaultPort = 40420;
+}
+
+/**
+ * Optional TCP server driving the Stage API from tablets and show control. Socket I/O runs on its own thread,
+ * decoded commands reach the game thread through a lock-free queue and replies go back the same way.
+ */
+class FStageAPIRemoteServer : public FRunnable
+{
+public:
+
+	FStageAPIRemoteServer();
+	virtual ~FStageAPIRemoteServer() override;
+
+	//Binds the listen socket and starts the worker. Returns false if the endpoint could not be bound. Port 0 picks a
+	//free port, GetEndpoint returns the one bound
+	bool StartServer(const FIPv4Endpoint& InEndpoint);
+	//Stops the worker and closes every connection. Commands not yet applied are dropped
+	void StopServer();
+	bool IsRunning() const { return Thread != nullptr; }
+	const FIPv4Endpoint& GetEndpoint() const { return Endpoint; }
+
+	//FRunnable
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+
+private:
+
+	struct FCommand
+	{
+		uint32 ClientId = 0;
+		StageAPIRemote::EOpcode Opcode = StageAPIRemote::EOpcode::Ping;
+		uint32 RequestId = 0;
+		EStageAPIProperty Property = EStageAPIProperty::None;
+		FVector4 Value = FVector4(0, 0, 0, 0);
+		float Duration = 0.0f;
+		uint8 Easing = 0;
+		int32 Frame = 0;
+		FString Name;
+	};
+
+	struct FReply
+	{
+		uint32 ClientId = 0;
+		TArray<uint8> Bytes;
+	};
+
+	struct FClient
+	{
+		FSocket* Socket = nullptr;
+		TArray<uint8> ReceiveBuffer;
+		TArray<uint8> SendBuffer;
+	};
+
+	//Worker thread
+	void AcceptClients();
+	bool ReceiveFromClient(uint32 ClientId, FClient& Client);
+	bool ProcessReceiveBuffer(uint32 ClientId, FClient& Client);
+	bool SendToClient(FClient& Client);
+	bool DecodeCommand(uint32 ClientId, const uint8* Payload, uint32 PayloadSize, FCommand& OutCommand) const;
+	void CloseClient(FClient& Client);
+
+	//Game thread
+	bool Tick(float DeltaTime);
+	void ExecuteCommand(IStageAPIEditor& API, const FCommand& Command);
+	void QueueReply(const FCommand& Command, StageAPIRemote::EOpcode Opcode, TFunctionRef<void(FArchive&)> WriteBody);
+
+	FIPv4Endpoint Endpoint;
+	FSocket* ListenSocket = nullptr;
+	FRunnableThread* Thread = nullptr;
+	std::atomic<bool> bStopping{ false };
+	//Wakes the worker when there are replies to send or it should stop
+	FEvent* WakeEvent = nullptr;
+
+	//Only touched by the worker
+	TMap<uint32, FClient> Clients;
+	uint32 NextClientId = 1;
+
+	//Worker -> game thread and game thread -> worker, each with a single producer
+	TQueue<FCommand, EQueueMode::Spsc> PendingCommands;
+	TQueue<FReply, EQueueMode::Spsc> PendingReplies;
+
+	FTSTicker::FDelegateHandle TickerHandle;
+};
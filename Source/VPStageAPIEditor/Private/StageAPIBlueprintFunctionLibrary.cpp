@@ -1,8 +1,46 @@
 ﻿#include "StageAPIBlueprintFunctionLibrary.h"
 #include "../Private/API/StageAPIEditorImpl.h"
+#include "API/StageAPIStats.h"
 
 void UStageAPIBlueprintFunctionLibrary::GetAPI(TScriptInterface<IStageAPIEditor>& OutAPI)
 {
 	static UStageAPIImpl* Obj = NewObject<UStageAPIImpl>(GetTransientPackage(),NAME_None,RF_MarkAsRootSet);
 	OutAPI = Obj;
 }
+
+bool UStageAPIBlueprintFunctionLibrary::GetAPILatency(FName FunctionName, FStageAPILatencyStats& OutStats)
+{
+	for (const FStageAPILatencyHistogram* Histogram = FStageAPILatencyHistogram::GetFirst(); Histogram; Histogram = Histogram->Next)
+	{
+		if (FunctionName == Histogram->Name)
+		{
+			OutStats = Histogram->GetStats();
+			return OutStats.Calls > 0;
+		}
+	}
+	return false;
+}
+
+TArray<FStageAPILatencyStats> UStageAPIBlueprintFunctionLibrary::GetAllAPILatencies()
+{
+	TArray<FStageAPILatencyStats> AllStats;
+	for (const FStageAPILatencyHistogram* Histogram = FStageAPILatencyHistogram::GetFirst(); Histogram; Histogram = Histogram->Next)
+	{
+		FStageAPILatencyStats Stats = Histogram->GetStats();
+		if (Stats.Calls > 0)
+		{
+			AllStats.Add(MoveTemp(Stats));
+		}
+	}
+
+	AllStats.Sort([](const FStageAPILatencyStats& A, const FStageAPILatencyStats& B) { return A.P99Us > B.P99Us; });
+	return AllStats;
+}
+
+void UStageAPIBlueprintFunctionLibrary::ResetAPILatencies()
+{
+	for (FStageAPILatencyHistogram* Histogram = FStageAPILatencyHistogram::GetFirst(); Histogram; Histogram = Histogram->Next)
+	{
+		Histogram->Reset();
+	}
+}
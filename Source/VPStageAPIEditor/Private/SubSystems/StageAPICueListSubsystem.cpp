@@ -0,0 +1,219 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "SubSystems/StageAPICueListSubsystem.h"
+#include "StageAPIBlueprintFunctionLibrary.h"
+#include "API/IStageAPIEditor.h"
+#include "API/StageAPIJournal.h"
+#include "Algo/BinarySearch.h"
+#include "Misc/App.h"
+
+void UStageAPICueListSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UStageAPICueListSubsystem::Tick));
+}
+
+void UStageAPICueListSubsystem::Deinitialize()
+{
+	FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+
+	Super::Deinitialize();
+}
+
+void UStageAPICueListSubsystem::AddCue(const FStageAPICue& Cue)
+{
+	//Upper bound keeps cues with equal times in insertion order
+	int32 const InsertIndex = Algo::UpperBoundBy(Cues, Cue.TimeSeconds, &FStageAPICue::TimeSeconds);
+	Cues.Insert(Cue, InsertIndex);
+}
+
+void UStageAPICueListSubsystem::AddCueAtTimecode(FName Name, FTimecode Timecode, FFrameRate FrameRate, const TArray<FStageAPICueChange>& Changes)
+{
+	FStageAPICue Cue;
+	Cue.Name = Name;
+	Cue.TimeSeconds = Timecode.ToTimespan(FrameRate).GetTotalSeconds();
+	Cue.Changes = Changes;
+	AddCue(Cue);
+}
+
+int32 UStageAPICueListSubsystem::RemoveCue(FName Name)
+{
+	return Cues.RemoveAll([Name](const FStageAPICue& Cue) { return Cue.Name == Name; });
+}
+
+void UStageAPICueListSubsystem::ClearCues()
+{
+	Cues.Reset();
+}
+
+void UStageAPICueListSubsystem::SetTimeSource(EStageAPICueTimeSource InTimeSource)
+{
+	//Times from the old clock mean nothing on the new one
+	TimeSource = InTimeSource;
+	bHasLastTime = false;
+}
+
+void UStageAPICueListSubsystem::SetArmed(bool bInArmed)
+{
+	bArmed = bInArmed;
+	bHasLastTime = false;
+}
+
+bool UStageAPICueListSubsystem::GetCurrentTime(double& OutTimeSeconds, bool& bOutAdvancing, TRange<double>& OutLoopRange) const
+{
+	OutLoopRange = TRange<double>::Empty();
+
+	if (TimeSource == EStageAPICueTimeSource::Sequencer)
+	{
+		//Polled every tick while armed, the status read is not an API call of its own
+		FStageAPIJournalScope JournalScope;
+		TScriptInterface<IStageAPIEditor> API;
+		UStageAPIBlueprintFunctionLibrary::GetAPI(API);
+
+		//Display rate frame time keeps the sub-frame part, TimeSeconds is only a float
+		FStageAPISequencerStatus const Status = API->GetSequencerStatus();
+		if (!Status.bValid)
+			return false;
+
+		OutTimeSeconds = Status.DisplayRate.AsSeconds(Status.DisplayFrameTime);
+		bOutAdvancing = Status.PlaybackStatus == EStageAPIPlaybackStatus::Playing;
+		if (Status.bLooping && Status.LoopStartFrameTime < Status.LoopEndFrameTime)
+		{
+			OutLoopRange = TRange<double>(Status.DisplayRate.AsSeconds(Status.LoopStartFrameTime), Status.DisplayRate.AsSeconds(Status.LoopEndFrameTime));
+		}
+		return true;
+	}
+
+	//Sub-frame time when the timecode provider supplies it, otherwise the whole frame timecode
+	if (TOptional<FQualifiedFrameTime> const FrameTime = FApp::GetCurrentFrameTime())
+	{
+		OutTimeSeconds = FrameTime->AsSeconds();
+	}
+	else
+	{
+		OutTimeSeconds = FApp::GetTimecode().ToTimespan(FApp::GetTimecodeFrameRate()).GetTotalSeconds();
+	}
+	bOutAdvancing = true;
+	return true;
+}
+
+bool UStageAPICueListSubsystem::Tick(float DeltaTime)
+{
+	if (!bArmed || Cues.Num() == 0)
+	{
+		bHasLastTime = false;
+		return true;
+	}
+
+	//Cues fired from the ticker are not journaled, an armed cue list fires them again on replay
+	FStageAPIJournalScope JournalScope;
+
+	double TimeSeconds = 0.0;
+	bool bAdvancing = false;
+	TRange<double> LoopRange;
+	if (!GetCurrentTime(TimeSeconds, bAdvancing, LoopRange))
+	{
+		bHasLastTime = false;
+		return true;
+	}
+
+	//The parked position was never part of a fired range, include cues sitting exactly on it
+	int32 const FirstIndex = bLastAdvancing
+		? Algo::UpperBoundBy(Cues, LastTimeSeconds, &FStageAPICue::TimeSeconds)
+		: Algo::LowerBoundBy(Cues, LastTimeSeconds, &FStageAPICue::TimeSeconds);
+
+	bool const bAdvanced = bHasLastTime && bAdvancing && TimeSeconds > LastTimeSeconds;
+	//Going backwards while playing with looping on is playback wrapping from the loop end to its start
+	bool const bWrapped = bHasLastTime && bAdvancing && TimeSeconds < LastTimeSeconds && !LoopRange.IsEmpty();
+	if (bAdvanced)
+	{
+		int32 const LastIndex = Algo::UpperBoundBy(Cues, TimeSeconds, &FStageAPICue::TimeSeconds);
+		if (FirstIndex < LastIndex)
+		{
+			FireCues(FirstIndex, LastIndex);
+		}
+	}
+	else if (bWrapped)
+	{
+		//The rest of the pass that ended, then the start of the new one
+		int32 const PassEndIndex = Algo::UpperBoundBy(Cues, LoopRange.GetUpperBoundValue(), &FStageAPICue::TimeSeconds);
+		if (FirstIndex < PassEndIndex)
+		{
+			FireCues(FirstIndex, PassEndIndex);
+		}
+
+		int32 const PassStartIndex = Algo::LowerBoundBy(Cues, LoopRange.GetLowerBoundValue(), &FStageAPICue::TimeSeconds);
+		int32 const LastIndex = Algo::UpperBoundBy(Cues, TimeSeconds, &FStageAPICue::TimeSeconds);
+		if (PassStartIndex < LastIndex)
+		{
+			FireCues(PassStartIndex, LastIndex);
+		}
+	}
+
+	LastTimeSeconds = TimeSeconds;
+	bHasLastTime = true;
+	//Only a tick that covered a range counts, the first playing tick may still report the parked frame
+	bLastAdvancing = bAdvanced || bWrapped;
+	return true;
+}
+
+void UStageAPICueListSubsystem::FireCues(int32 FirstIndex, int32 LastIndex)
+{
+	TScriptInterface<IStageAPIEditor> API;
+	UStageAPIBlueprintFunctionLibrary::GetAPI(API);
+	if (!API->IsAPIReady())
+		return;
+
+	//Copy first, a delegate may edit the cue list
+	TArray<FStageAPICue> FiredCues(Cues.GetData() + FirstIndex, LastIndex - FirstIndex);
+
+	FString const Description = FiredCues.Num() == 1
+		? FString::Printf(TEXT("Cue %s"), *FiredCues[0].Name.ToString())
+		: FString::Printf(TEXT("Cues %s - %s"), *FiredCues[0].Name.ToString(), *FiredCues.Last().Name.ToString());
+	{
+		FStageAPIScopedBatch Batch(*API, Description);
+		for (const FStageAPICue& Cue : FiredCues)
+		{
+			for (const FStageAPICueChange& Change : Cue.Changes)
+			{
+				API->SetPropertyValue(Change.Property, Change.Value);
+			}
+		}
+
+		//With write coalescing on the values would otherwise wait for the next flush
+		API->FlushPendingWrites();
+	}
+
+	for (const FStageAPICue& Cue : FiredCues)
+	{
+		OnCueFired.Broadcast(Cue.Name, Cue.TimeSeconds);
+	}
+}
+
+bool UStageAPICueListSubsystem::GetNextCue(FStageAPICue& OutCue) const
+{
+	double TimeSeconds = 0.0;
+	bool bAdvancing = false;
+	TRange<double> LoopRange;
+	if (!GetCurrentTime(TimeSeconds, bAdvancing, LoopRange))
+		return false;
+
+	int32 const NextIndex = Algo::UpperBoundBy(Cues, TimeSeconds, &FStageAPICue::TimeSeconds);
+	if (!Cues.IsValidIndex(NextIndex))
+		return false;
+
+	OutCue = Cues[NextIndex];
+	return true;
+}
+
+bool UStageAPICueListSubsystem::FireCue(FName Name)
+{
+	int32 const CueIndex = Cues.IndexOfByPredicate([Name](const FStageAPICue& Cue) { return Cue.Name == Name; });
+	if (CueIndex == INDEX_NONE)
+		return false;
+
+	FireCues(CueIndex, CueIndex + 1);
+	return true;
+}
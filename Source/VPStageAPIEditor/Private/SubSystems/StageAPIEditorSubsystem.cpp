@@ -2,4 +2,129 @@
 
 
 #include "SubSystems/StageAPIEditorSubsystem.h"
+#include "StageAPIBlueprintFunctionLibrary.h"
+#include "API/StageAPIJournal.h"
+#include "CineCameraActor.h"
+#include "DisplayClusterRootActor.h"
+#include "Misc/TransactionObjectEvent.h"
+#include "UObject/UObjectGlobals.h"
 
+void UStageAPIEditorSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	OnObjectPropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddUObject(this, &UStageAPIEditorSubsystem::HandleObjectPropertyChanged);
+	OnObjectTransactedHandle = FCoreUObjectDelegates::OnObjectTransacted.AddUObject(this, &UStageAPIEditorSubsystem::HandleObjectTransacted);
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UStageAPIEditorSubsystem::Tick));
+}
+
+void UStageAPIEditorSubsystem::Deinitialize()
+{
+	FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(OnObjectPropertyChangedHandle);
+	FCoreUObjectDelegates::OnObjectTransacted.Remove(OnObjectTransactedHandle);
+	FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+
+	Super::Deinitialize();
+}
+
+void UStageAPIEditorSubsystem::MarkStagePropertiesDirty()
+{
+	bDirty = true;
+}
+
+void UStageAPIEditorSubsystem::SetStageRoot(ADisplayClusterRootActor* Root)
+{
+	if (Root == StageRoot.Get() && (bHasLastValues || !Root))
+		return;
+
+	StageRoot = Root;
+	bHasLastValues = false;
+	if (Root)
+	{
+		FlushStagePropertyNotifications();
+	}
+}
+
+bool UStageAPIEditorSubsystem::IsStageObject(const UObject* Object) const
+{
+	if (!Object)
+		return false;
+
+	//Root actor, its config data and components (ICVFX cameras, default view point)
+	if (Object->IsA<ADisplayClusterRootActor>() || Object->GetTypedOuter<ADisplayClusterRootActor>())
+		return true;
+
+	//Frustum cameras and their cine camera components
+	if (Object->IsA<ACineCameraActor>() || Object->GetTypedOuter<ACineCameraActor>())
+		return true;
+
+	//The actor the root is attached to carries the stage transform
+	ADisplayClusterRootActor* Root = StageRoot.Get();
+	const AActor* StageParent = Root ? Root->GetAttachParentActor() : nullptr;
+	return StageParent && (Object == StageParent || Object->IsIn(StageParent));
+}
+
+void UStageAPIEditorSubsystem::HandleObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& PropertyChangedEvent)
+{
+	if (!bDirty && IsStageObject(Object))
+	{
+		bDirty = true;
+	}
+}
+
+void UStageAPIEditorSubsystem::HandleObjectTransacted(UObject* Object, const FTransactionObjectEvent& TransactionEvent)
+{
+	//Undo/redo and transactions received from other Multi-User clients
+	if (!bDirty && IsStageObject(Object))
+	{
+		bDirty = true;
+	}
+}
+
+bool UStageAPIEditorSubsystem::Tick(float DeltaTime)
+{
+	//A root without a baseline (its first read failed) is retried, without a root there is nothing to poll until
+	//the API finds one and calls SetStageRoot
+	if (bDirty || (!bHasLastValues && StageRoot.IsValid()))
+	{
+		FlushStagePropertyNotifications();
+	}
+	return true;
+}
+
+void UStageAPIEditorSubsystem::FlushStagePropertyNotifications()
+{
+	bDirty = false;
+
+	//Reads made to detect changes are not API calls of their own
+	FStageAPIJournalScope JournalScope;
+	TScriptInterface<IStageAPIEditor> API;
+	UStageAPIBlueprintFunctionLibrary::GetAPI(API);
+	if (!API->IsAPIReady())
+	{
+		bHasLastValues = false;
+		return;
+	}
+
+	//The first read after the stage appears is the baseline, not a change
+	bool const bBroadcast = bHasLastValues;
+	bHasLastValues = true;
+
+	for (EStageAPIProperty Property : TEnumRange<EStageAPIProperty>())
+	{
+		if (Property == EStageAPIProperty::None)
+			continue;
+
+		FVector4 const Value = API->GetPropertyValue(Property);
+		FVector4& LastValue = LastValues[static_cast<uint8>(Property)];
+		if (bBroadcast && Value == LastValue)
+			continue;
+
+		LastValue = Value;
+		if (bBroadcast)
+		{
+			OnStagePropertyChangedNative.Broadcast(Property, Value);
+			OnStagePropertyChanged.Broadcast(Property, Value);
+		}
+	}
+}
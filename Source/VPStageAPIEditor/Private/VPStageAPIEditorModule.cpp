@@ -1,20 +1,328 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "VPStageAPIEditorModule.h"
+#include "Remote/StageAPIRemoteServer.h"
+#include "Remote/StageAPIOscListener.h"
+#include "Remote/StageAPIDmxInput.h"
+#include "API/StageAPIJournal.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/Paths.h"
 
 DEFINE_LOG_CATEGORY(StageAPIEditor);
 
 #define LOCTEXT_NAMESPACE "FVPStageAPIEditorModule"
 
+//StageAPI.Remote.Start [Address=127.0.0.1] [Port=40420]
+static FAutoConsoleCommand StageAPIRemoteStartCommand(
+	TEXT("StageAPI.Remote.Start"),
+	TEXT("Starts the Stage API remote control server. Args: Address= (default loopback) Port="),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		FString const CommandLine = FString::Join(Args, TEXT(" "));
+		FString Address = TEXT("127.0.0.1");
+		uint16 Port = StageAPIRemote::DefaultPort;
+		FParse::Value(*CommandLine, TEXT("Address="), Address);
+		FParse::Value(*CommandLine, TEXT("Port="), Port);
+		FModuleManager::GetModuleChecked<FVPStageAPIEditorModule>("VPStageAPIEditor").StartRemoteServer(Address, Port);
+	}));
+
+static FAutoConsoleCommand StageAPIRemoteStopCommand(
+	TEXT("StageAPI.Remote.Stop"),
+	TEXT("Stops the Stage API remote control server"),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		FModuleManager::GetModuleChecked<FVPStageAPIEditorModule>("VPStageAPIEditor").StopRemoteServer();
+	}));
+
+//StageAPI.Osc.Start [Address=127.0.0.1] [Port=8000]
+static FAutoConsoleCommand StageAPIOscStartCommand(
+	TEXT("StageAPI.Osc.Start"),
+	TEXT("Starts the Stage API OSC listener. Args: Address= (default loopback, 0.0.0.0 for all interfaces) Port="),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		FString const CommandLine = FString::Join(Args, TEXT(" "));
+		FString Address = TEXT("127.0.0.1");
+		uint16 Port = StageAPIOscDefaultPort;
+		FParse::Value(*CommandLine, TEXT("Address="), Address);
+		FParse::Value(*CommandLine, TEXT("Port="), Port);
+		FModuleManager::GetModuleChecked<FVPStageAPIEditorModule>("VPStageAPIEditor").StartOscListener(Address, Port);
+	}));
+
+static FAutoConsoleCommand StageAPIOscStopCommand(
+	TEXT("StageAPI.Osc.Stop"),
+	TEXT("Stops the Stage API OSC listener"),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		FModuleManager::GetModuleChecked<FVPStageAPIEditorModule>("VPStageAPIEditor").StopOscListener();
+	}));
+
+//StageAPI.Osc.Map /stage/frustum/exposure FrustumExposure
+static FAutoConsoleCommand StageAPIOscMapCommand(
+	TEXT("StageAPI.Osc.Map"),
+	TEXT("Maps an OSC address to a Stage API property. Args: <Address> <EStageAPIProperty name>"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		if (Args.Num() != 2)
+		{
+			UE_LOG(StageAPIEditor, Warning, TEXT("Usage: StageAPI.Osc.Map <Address> <Property>"));
+			return;
+		}
+		FModuleManager::GetModuleChecked<FVPStageAPIEditorModule>("VPStageAPIEditor").SetOscAddressMapping(Args[0], Args[1]);
+	}));
+
+//StageAPI.Dmx.Start [Protocol=ArtNet|sACN] [Address=0.0.0.0]
+static FAutoConsoleCommand StageAPIDmxStartCommand(
+	TEXT("StageAPI.Dmx.Start"),
+	TEXT("Starts Stage API DMX input. Args: Protocol=ArtNet|sACN (default ArtNet) Address= (default all interfaces)"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		FString const CommandLine = FString::Join(Args, TEXT(" "));
+		FString Protocol = TEXT("ArtNet");
+		FString Address = TEXT("0.0.0.0");
+		FParse::Value(*CommandLine, TEXT("Protocol="), Protocol);
+		FParse::Value(*CommandLine, TEXT("Address="), Address);
+		FModuleManager::GetModuleChecked<FVPStageAPIEditorModule>("VPStageAPIEditor").StartDmxInput(Protocol, Address);
+	}));
+
+static FAutoConsoleCommand StageAPIDmxStopCommand(
+	TEXT("StageAPI.Dmx.Stop"),
+	TEXT("Stops Stage API DMX input"),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		FModuleManager::GetModuleChecked<FVPStageAPIEditorModule>("VPStageAPIEditor").StopDmxInput();
+	}));
+
+//StageAPI.Dmx.Map Universe=1 Channel=1 Property=FrustumExposure [Component=0] [Fine] [Min=0] [Max=1]
+static FAutoConsoleCommand StageAPIDmxMapCommand(
+	TEXT("StageAPI.Dmx.Map"),
+	TEXT("Maps a DMX channel to a Stage API property component. Args: Universe= Channel= Property= Component= Fine (16 bit coarse/fine pair) Min= Max="),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		FString const CommandLine = FString::Join(Args, TEXT(" "));
+		FStageAPIDmxMapping Mapping;
+		FString PropertyName;
+		FParse::Value(*CommandLine, TEXT("Universe="), Mapping.Universe);
+		FParse::Value(*CommandLine, TEXT("Channel="), Mapping.Channel);
+		FParse::Value(*CommandLine, TEXT("Property="), PropertyName);
+		FParse::Value(*CommandLine, TEXT("Component="), Mapping.Component);
+		FParse::Value(*CommandLine, TEXT("Min="), Mapping.Min);
+		FParse::Value(*CommandLine, TEXT("Max="), Mapping.Max);
+		Mapping.b16Bit = FParse::Param(*CommandLine, TEXT("Fine")) || Args.Contains(TEXT("Fine"));
+
+		int64 const PropertyValue = StaticEnum<EStageAPIProperty>()->GetValueByNameString(PropertyName);
+		if (PropertyValue == INDEX_NONE || PropertyValue == static_cast<int64>(EStageAPIProperty::None) || PropertyValue >= static_cast<int64>(EStageAPIProperty::Count)
+			|| Mapping.Channel < 1 || Mapping.Channel + (Mapping.b16Bit ? 1 : 0) > FStageAPIDmxInput::UniverseSize || Mapping.Component > 3)
+		{
+			UE_LOG(StageAPIEditor, Warning, TEXT("Usage: StageAPI.Dmx.Map Universe= Channel=<1-512> Property=<EStageAPIProperty> [Component=<0-3>] [Fine] [Min=] [Max=]"));
+			return;
+		}
+
+		Mapping.Property = static_cast<EStageAPIProperty>(PropertyValue);
+		FModuleManager::GetModuleChecked<FVPStageAPIEditorModule>("VPStageAPIEditor").GetDmxInput().AddMapping(Mapping);
+	}));
+
+//StageAPI.Dmx.Patch [Universe=1]
+static FAutoConsoleCommand StageAPIDmxPatchCommand(
+	TEXT("StageAPI.Dmx.Patch"),
+	TEXT("Adds the default 16 bit stage fixture at channel 1 of a universe. Args: Universe= (default 1)"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		FString const CommandLine = FString::Join(Args, TEXT(" "));
+		uint16 Universe = 1;
+		FParse::Value(*CommandLine, TEXT("Universe="), Universe);
+		FModuleManager::GetModuleChecked<FVPStageAPIEditorModule>("VPStageAPIEditor").GetDmxInput().AddDefaultPatch(Universe);
+	}));
+
+static FAutoConsoleCommand StageAPIDmxClearCommand(
+	TEXT("StageAPI.Dmx.Clear"),
+	TEXT("Removes every Stage API DMX channel mapping"),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		FModuleManager::GetModuleChecked<FVPStageAPIEditorModule>("VPStageAPIEditor").GetDmxInput().ClearMappings();
+	}));
+
+FVPStageAPIEditorModule::FVPStageAPIEditorModule()
+{
+}
+
+FVPStageAPIEditorModule::~FVPStageAPIEditorModule()
+{
+}
+
 void FVPStageAPIEditorModule::StartupModule()
 {
 	// This code will execute after your module is loaded into memory; the exact timing is specified in the .uplugin file per-module
+
+	//-StageAPIRemotePort=<port> [-StageAPIRemoteAddress=<ip>] starts the remote server with the editor
+	uint16 RemotePort = 0;
+	if (FParse::Value(FCommandLine::Get(), TEXT("StageAPIRemotePort="), RemotePort))
+	{
+		FString RemoteAddress = TEXT("127.0.0.1");
+		FParse::Value(FCommandLine::Get(), TEXT("StageAPIRemoteAddress="), RemoteAddress);
+		StartRemoteServer(RemoteAddress, RemotePort);
+	}
+
+	//-StageAPIOscPort=<port> [-StageAPIOscAddress=<ip>] starts the OSC listener with the editor, on loopback unless
+	//an address is given. Consoles on the network need -StageAPIOscAddress=0.0.0.0 or the interface's address
+	uint16 OscPort = 0;
+	if (FParse::Value(FCommandLine::Get(), TEXT("StageAPIOscPort="), OscPort))
+	{
+		FString OscAddress = TEXT("127.0.0.1");
+		FParse::Value(FCommandLine::Get(), TEXT("StageAPIOscAddress="), OscAddress);
+		StartOscListener(OscAddress, OscPort);
+	}
+
+	//-StageAPIJournal[=<path>] records every API call from startup, for crash repro traces
+	FString JournalPath;
+	if (FParse::Value(FCommandLine::Get(), TEXT("StageAPIJournal="), JournalPath))
+	{
+		FStageAPIJournal::StartRecording(JournalPath);
+	}
+	else if (FParse::Param(FCommandLine::Get(), TEXT("StageAPIJournal")))
+	{
+		FStageAPIJournal::StartRecording(FPaths::ProjectSavedDir() / TEXT("VPStageAPI/Journal") / (FDateTime::Now().ToString() + TEXT(".vpsj")));
+	}
 }
 
 void FVPStageAPIEditorModule::ShutdownModule()
 {
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
+	StopRemoteServer();
+	OscListener.Reset();
+	DmxInput.Reset();
+	FStageAPIJournal::StopReplay();
+	FStageAPIJournal::StopRecording();
+}
+
+bool FVPStageAPIEditorModule::StartRemoteServer(const FString& BindAddress, uint16 Port)
+{
+	FIPv4Address Address;
+	if (!FIPv4Address::Parse(BindAddress, Address))
+	{
+		UE_LOG(StageAPIEditor, Error, TEXT("VP Stage API remote server: '%s' is not an IPv4 address"), *BindAddress);
+		return false;
+	}
+
+	StopRemoteServer();
+
+	RemoteServer = MakeUnique<FStageAPIRemoteServer>();
+	if (!RemoteServer->StartServer(FIPv4Endpoint(Address, Port)))
+	{
+		RemoteServer.Reset();
+		return false;
+	}
+	return true;
+}
+
+void FVPStageAPIEditorModule::StopRemoteServer()
+{
+	RemoteServer.Reset();
+}
+
+bool FVPStageAPIEditorModule::IsRemoteServerRunning() const
+{
+	return RemoteServer.IsValid() && RemoteServer->IsRunning();
+}
+
+bool FVPStageAPIEditorModule::StartOscListener(const FString& BindAddress, uint16 Port)
+{
+	FIPv4Address Address;
+	if (!FIPv4Address::Parse(BindAddress, Address))
+	{
+		UE_LOG(StageAPIEditor, Error, TEXT("VP Stage API OSC listener: '%s' is not an IPv4 address"), *BindAddress);
+		return false;
+	}
+
+	if (!OscListener.IsValid())
+	{
+		OscListener = MakeUnique<FStageAPIOscListener>();
+	}
+
+	OscListener->StopListening();
+	return OscListener->StartListening(FIPv4Endpoint(Address, Port));
+}
+
+void FVPStageAPIEditorModule::StopOscListener()
+{
+	if (OscListener.IsValid())
+	{
+		OscListener->StopListening();
+	}
+}
+
+bool FVPStageAPIEditorModule::IsOscListenerRunning() const
+{
+	return OscListener.IsValid() && OscListener->IsListening();
+}
+
+bool FVPStageAPIEditorModule::SetOscAddressMapping(const FString& Address, const FString& PropertyName)
+{
+	int64 const PropertyValue = StaticEnum<EStageAPIProperty>()->GetValueByNameString(PropertyName);
+	if (PropertyValue == INDEX_NONE || PropertyValue == static_cast<int64>(EStageAPIProperty::None) || PropertyValue >= static_cast<int64>(EStageAPIProperty::Count))
+	{
+		UE_LOG(StageAPIEditor, Error, TEXT("VP Stage API OSC: '%s' is not a Stage API property"), *PropertyName);
+		return false;
+	}
+
+	if (!OscListener.IsValid())
+	{
+		OscListener = MakeUnique<FStageAPIOscListener>();
+	}
+
+	OscListener->SetAddressMapping(Address, static_cast<EStageAPIProperty>(PropertyValue));
+	return true;
+}
+
+bool FVPStageAPIEditorModule::StartDmxInput(const FString& Protocol, const FString& BindAddress)
+{
+	FIPv4Address Address;
+	if (!FIPv4Address::Parse(BindAddress, Address))
+	{
+		UE_LOG(StageAPIEditor, Error, TEXT("VP Stage API DMX input: '%s' is not an IPv4 address"), *BindAddress);
+		return false;
+	}
+
+	EStageAPIDmxProtocol DmxProtocol;
+	if (Protocol.Equals(TEXT("ArtNet"), ESearchCase::IgnoreCase) || Protocol.Equals(TEXT("Art-Net"), ESearchCase::IgnoreCase))
+	{
+		DmxProtocol = EStageAPIDmxProtocol::ArtNet;
+	}
+	else if (Protocol.Equals(TEXT("sACN"), ESearchCase::IgnoreCase) || Protocol.Equals(TEXT("E1.31"), ESearchCase::IgnoreCase))
+	{
+		DmxProtocol = EStageAPIDmxProtocol::Sacn;
+	}
+	else
+	{
+		UE_LOG(StageAPIEditor, Error, TEXT("VP Stage API DMX input: unknown protocol '%s', expected ArtNet or sACN"), *Protocol);
+		return false;
+	}
+
+	FStageAPIDmxInput& Input = GetDmxInput();
+	Input.StopListening();
+	return Input.StartListening(DmxProtocol, Address);
+}
+
+void FVPStageAPIEditorModule::StopDmxInput()
+{
+	if (DmxInput.IsValid())
+	{
+		DmxInput->StopListening();
+	}
+}
+
+bool FVPStageAPIEditorModule::IsDmxInputRunning() const
+{
+	return DmxInput.IsValid() && DmxInput->IsListening();
+}
+
+FStageAPIDmxInput& FVPStageAPIEditorModule::GetDmxInput()
+{
+	if (!DmxInput.IsValid())
+	{
+		DmxInput = MakeUnique<FStageAPIDmxInput>();
+	}
+	return *DmxInput;
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -1,13 +1,18 @@
 ﻿#pragma once
 
 #include "CoreMinimal.h"
+#include "Misc/FrameTime.h"
+#include "Misc/Timecode.h"
 #include "CineCameraActor.h"
 #include "LevelSequenceActor.h"
+#include "Kismet/KismetMathLibrary.h"
+#include "StageAPITypes.h"
 
 #include "IStageAPIEditor.generated.h"
 
 class ADisplayClusterRootActor;
 class UDisplayClusterICVFXCameraComponent;
+class ULevelSequence;
 
 UINTERFACE(meta = (CannotImplementInterfaceInBlueprint))
 class VPSTAGEAPIEDITOR_API UStageAPIEditor : public UInterface
@@ -29,6 +34,271 @@ public:
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Init API",ShortTooltip="Implicit in API calls, not needed in most cases"), Category = "VP Stage API")
 	virtual bool InitAPISurface() = 0;
 
+	//Number of times the API has rescanned the world for a nDisplay root. Rescans only happen when the stage topology changes
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Get API Rescan Count"), Category = "VP Stage API")
+	virtual int32 GetAPISurfaceRescanCount() const = 0;
+
+
+#pragma region "Batching"
+
+	//////////////////////////////////////////////////////////////////////////////////////////////
+	// Batching
+	//
+	//Setters called between BeginBatch and CommitBatch share a single undo/Multi-User transaction.
+	//Batches can be nested, only the outermost CommitBatch ends the transaction.
+	//////////////////////////////////////////////////////////////////////////////////////////////
+
+	////** Opens a batch. All API setters until the matching CommitBatch are recorded as one transaction */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Begin Batch"), Category = "VP Stage API|Batch")
+	virtual void BeginBatch(const FString& Description) = 0;
+
+	////** Closes the batch and sends it to the Multi-User session as a single transaction */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Commit Batch"), Category = "VP Stage API|Batch")
+	virtual void CommitBatch() = 0;
+
+	////** Returns true while a batch is open */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Is Batch Open"), Category = "VP Stage API|Batch")
+	virtual bool IsBatchOpen() const = 0;
+
+#pragma endregion
+
+#pragma region "Property Access & Write Coalescing"
+
+	//////////////////////////////////////////////////////////////////////////////////////////////
+	// Property Access
+	//
+	//Generic access to the stage parameters listed in EStageAPIProperty. Scalars use X, bools X != 0,
+	//vectors XYZ and rotators (Pitch, Yaw, Roll).
+	//////////////////////////////////////////////////////////////////////////////////////////////
+
+	////** Reads a stage parameter */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Get Property Value"), Category = "VP Stage API|Properties")
+	virtual FVector4 GetPropertyValue(EStageAPIProperty Property) const = 0;
+
+	////** Writes a stage parameter through its regular setter */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Set Property Value"), Category = "VP Stage API|Properties")
+	virtual void SetPropertyValue(EStageAPIProperty Property, FVector4 Value) = 0;
+
+	//////////////////////////////////////////////////////////////////////////////////////////////
+	// Write Coalescing
+	//
+	//For slider driven setters. While coalescing is enabled setters only store the latest value per property,
+	//pending values are applied together once per editor tick (FlushRate 0) or FlushRate times per second.
+	//////////////////////////////////////////////////////////////////////////////////////////////
+
+	////** Enables latest-value-wins coalescing of setter calls. FlushRate is in Hz, 0 flushes every editor tick */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Set Write Coalescing"), Category = "VP Stage API|Write Coalescing")
+	virtual void SetWriteCoalescing(bool bEnabled, float FlushRate = 0) = 0;
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Is Write Coalescing Enabled"), Category = "VP Stage API|Write Coalescing")
+	virtual bool IsWriteCoalescingEnabled() const = 0;
+
+	////** Applies all pending values now */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Flush Pending Writes"), Category = "VP Stage API|Write Coalescing")
+	virtual void FlushPendingWrites() = 0;
+
+	////** Starts an interaction (e.g. slider drag). Values are previewed locally and only committed by EndInteraction */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Begin Interaction"), Category = "VP Stage API|Write Coalescing")
+	virtual void BeginInteraction() = 0;
+
+	////** Ends the interaction and commits the final values as a single transaction */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "End Interaction"), Category = "VP Stage API|Write Coalescing")
+	virtual void EndInteraction() = 0;
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Is Interaction Active"), Category = "VP Stage API|Write Coalescing")
+	virtual bool IsInteractionActive() const = 0;
+
+#pragma endregion
+
+#pragma region "Preview Sessions"
+
+	//////////////////////////////////////////////////////////////////////////////////////////////
+	// Preview Sessions
+	//
+	//Between BeginPreviewSession and Commit/CancelPreviewSession all API setters (exposure, FOV mult, render ratio,
+	//grades, chromakey, stage transform etc.) are applied locally at frame rate without transactions.
+	//////////////////////////////////////////////////////////////////////////////////////////////
+
+	////** Snapshots the stage and starts previewing edits locally. Returns false if a session is already open */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Begin Preview Session"), Category = "VP Stage API|Preview")
+	virtual bool BeginPreviewSession() = 0;
+
+	////** Ends the session and sends the net change against the snapshot as a single transaction */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Commit Preview Session"), Category = "VP Stage API|Preview")
+	virtual void CommitPreviewSession() = 0;
+
+	////** Ends the session and restores the snapshot */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Cancel Preview Session"), Category = "VP Stage API|Preview")
+	virtual void CancelPreviewSession() = 0;
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Is Preview Session Active"), Category = "VP Stage API|Preview")
+	virtual bool IsPreviewSessionActive() const = 0;
+
+#pragma endregion
+
+#pragma region "Transitions"
+
+	//////////////////////////////////////////////////////////////////////////////////////////////
+	// Transitions
+	//
+	//Eased changes of any numeric property (float, FVector, FRotator, FVector4 in the EStageAPIProperty layout) over
+	//time. Intermediate frames are applied locally, undo and Multi-User only receive the start and end values.
+	//////////////////////////////////////////////////////////////////////////////////////////////
+
+	////** Moves a property to TargetValue over Duration seconds. Starting again on the same property retargets it from its current value */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Start Transition", AdvancedDisplay = "BlendExp,Steps"), Category = "VP Stage API|Transitions")
+	virtual bool StartTransition(EStageAPIProperty Property, FVector4 TargetValue, float Duration, TEnumAsByte<EEasingFunc::Type> Easing = EEasingFunc::Linear, float BlendExp = 2.0f, int32 Steps = 2) = 0;
+
+	////** Stops a transition and records it, either at its current value or at its target */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Cancel Transition"), Category = "VP Stage API|Transitions")
+	virtual void CancelTransition(EStageAPIProperty Property, bool bJumpToEnd = false) = 0;
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Cancel All Transitions"), Category = "VP Stage API|Transitions")
+	virtual void CancelAllTransitions(bool bJumpToEnd = false) = 0;
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Is Transition Active"), Category = "VP Stage API|Transitions")
+	virtual bool IsTransitionActive(EStageAPIProperty Property) const = 0;
+
+#pragma endregion
+
+#pragma region "Root Registry"
+
+	//////////////////////////////////////////////////////////////////////////////////////////////
+	// Root Registry
+	//
+	//For stages with several nDisplay roots. Roots are addressed by actor name or outliner label and can be
+	//grouped by actor tag. All other API calls target the active root or the root pushed with PushTargetRoot.
+	//////////////////////////////////////////////////////////////////////////////////////////////
+
+	////** Actor names of every nDisplay root in the world, sorted */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Get Root Names"), Category = "VP Stage API|Roots")
+	virtual TArray<FName> GetRootNames() const = 0;
+
+	////** Actor names of the nDisplay roots carrying the given actor tag */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Get Root Names With Tag"), Category = "VP Stage API|Roots")
+	virtual TArray<FName> GetRootNamesWithTag(FName Tag) const = 0;
+
+	////** Finds a root by actor name or label */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Find Root"), Category = "VP Stage API|Roots")
+	virtual ADisplayClusterRootActor* FindRoot(FName RootName) const = 0;
+
+	////** Selects the root that API calls target. Kept across rescans while the root exists. Fails while a target root is pushed */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Set Active Root"), Category = "VP Stage API|Roots")
+	virtual bool SetActiveRoot(FName RootName) = 0;
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Get Active Root Name"), Category = "VP Stage API|Roots")
+	virtual FName GetActiveRootName() const = 0;
+
+	////** Temporarily targets API calls at another root until the matching PopTargetRoot. Returns false if the root was not found */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Push Target Root"), Category = "VP Stage API|Roots")
+	virtual bool PushTargetRoot(FName RootName) = 0;
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Pop Target Root"), Category = "VP Stage API|Roots")
+	virtual void PopTargetRoot() = 0;
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Get Property Value On Root"), Category = "VP Stage API|Roots")
+	virtual FVector4 GetPropertyValueOnRoot(FName RootName, EStageAPIProperty Property) = 0;
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Set Property Value On Root"), Category = "VP Stage API|Roots")
+	virtual bool SetPropertyValueOnRoot(FName RootName, EStageAPIProperty Property, FVector4 Value) = 0;
+
+	////** Sets a stage parameter on every root as a single transaction */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Set Property Value On All Roots"), Category = "VP Stage API|Roots")
+	virtual void SetPropertyValueOnAllRoots(EStageAPIProperty Property, FVector4 Value) = 0;
+
+	////** Sets a stage parameter on every root with the given actor tag as a single transaction */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Set Property Value On Roots With Tag"), Category = "VP Stage API|Roots")
+	virtual void SetPropertyValueOnRootsWithTag(FName Tag, EStageAPIProperty Property, FVector4 Value) = 0;
+
+#pragma endregion
+
+#pragma region "Viewport Render Settings"
+
+	//////////////////////////////////////////////////////////////////////////////////////////////
+	// Viewport Render Settings & Render Tiers
+	//
+	//Per viewport screen percentage for trimming render cost on parts of the volume (e.g. ceiling) without
+	//touching the main wall. Each call is a single transaction. Render tiers are named profiles matched against
+	//viewport names, built in tiers are "full", "rehearsal" and "ceiling-low".
+	//////////////////////////////////////////////////////////////////////////////////////////////
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Get Viewport Render Settings"), Category = "VP Stage API|Render Tiers")
+	virtual FStageAPIViewportRenderSettings GetViewportRenderSettings(const FString& ViewportName) const = 0;
+
+	////** Sets the render settings of every listed viewport in one transaction */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Set Viewport Render Settings"), Category = "VP Stage API|Render Tiers")
+	virtual void SetViewportRenderSettings(const TArray<FString>& ViewportNames, FStageAPIViewportRenderSettings Settings) = 0;
+
+	////** Sets the render settings of every viewport on a cluster node in one transaction */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Set Node Render Settings"), Category = "VP Stage API|Render Tiers")
+	virtual void SetNodeRenderSettings(const FString& NodeName, FStageAPIViewportRenderSettings Settings) = 0;
+
+	////** Adds or replaces a render tier. Replacing a built in tier name overrides it */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Set Render Tier"), Category = "VP Stage API|Render Tiers")
+	virtual void SetRenderTier(FName TierName, const FStageAPIRenderTier& Tier) = 0;
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Get Render Tier Names"), Category = "VP Stage API|Render Tiers")
+	virtual TArray<FName> GetRenderTierNames() const = 0;
+
+	////** Applies a render tier to the stage in one transaction. Returns false if the tier does not exist */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Apply Render Tier"), Category = "VP Stage API|Render Tiers")
+	virtual bool ApplyRenderTier(FName TierName) = 0;
+
+	////** The last tier applied through the API, None if no tier has been applied */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Get Active Render Tier"), Category = "VP Stage API|Render Tiers")
+	virtual FName GetActiveRenderTier() const = 0;
+
+#pragma endregion
+
+#pragma region "Stage State"
+
+	//////////////////////////////////////////////////////////////////////////////////////////////
+	// Stage State
+	//////////////////////////////////////////////////////////////////////////////////////////////
+
+	////** Stage transform, default view, both frustums, grades, chromakey and screen percentages in a single call */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Get Stage State"), Category = "VP Stage API|Stage State")
+	virtual FStageAPIStageState GetStageState() const = 0;
+
+	////** As Get Stage State, but read once per frame and shared by every caller in that frame */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Get Stage State (Cached)"), Category = "VP Stage API|Stage State")
+	virtual FStageAPIStageState GetStageStateCached() const = 0;
+
+#pragma endregion
+
+#pragma region "Presets"
+
+	//////////////////////////////////////////////////////////////////////////////////////////////
+	// Stage Presets
+	//
+	//A preset holds the stage transform, default view, exposure, both frustums, both grades and the screen
+	//percentages and viewport render settings. Recall only touches what differs and is one transaction.
+	//////////////////////////////////////////////////////////////////////////////////////////////
+
+	////** Captures the live stage into a named preset, replacing a preset with the same name */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Capture Preset"), Category = "VP Stage API|Presets")
+	virtual bool CapturePreset(FName PresetName) = 0;
+
+	////** Applies a preset in one transaction. Returns false if the preset does not exist */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Recall Preset"), Category = "VP Stage API|Presets")
+	virtual bool RecallPreset(FName PresetName) = 0;
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Delete Preset"), Category = "VP Stage API|Presets")
+	virtual bool DeletePreset(FName PresetName) = 0;
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Get Preset Names"), Category = "VP Stage API|Presets")
+	virtual TArray<FName> GetPresetNames() const = 0;
+
+	////** Writes all presets to a binary file. An empty path uses Saved/VPStageAPI/StagePresets.bin */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Save Presets"), Category = "VP Stage API|Presets")
+	virtual bool SavePresets(const FString& FilePath) = 0;
+
+	////** Replaces the presets in memory with the ones in the file. An empty path uses Saved/VPStageAPI/StagePresets.bin */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Load Presets"), Category = "VP Stage API|Presets")
+	virtual bool LoadPresets(const FString& FilePath) = 0;
+
+#pragma endregion
+
 
 #pragma region "nDisplay API"
 	
@@ -72,6 +342,18 @@ public:
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Get Viewport Names"), Category = "VP Stage API|nDisplay")
 	virtual TArray<FString> GetViewportNames() const =0;
 
+	////Returns the list of cluster nodes registered in the cluster
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Get Cluster Node Names"), Category = "VP Stage API|nDisplay")
+	virtual TArray<FString> GetClusterNodeNames() const =0;
+
+	////Returns the cluster node that renders the viewport, empty if the viewport is unknown
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Get Viewport Node Name"), Category = "VP Stage API|nDisplay")
+	virtual FString GetViewportNodeName(const FString& ViewportName) const =0;
+
+	////Changes every time the active root's cluster nodes or viewports change or another root becomes active, 0 without a root. Cache node/viewport lists against this value
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Get Topology Generation"), Category = "VP Stage API|nDisplay")
+	virtual int32 GetTopologyGeneration() const =0;
+
 	////** Get the Viewport screen percentage multiplier. */
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Get Global Screen Percentage"), Category = "VP Stage API|nDisplay")
 	virtual float GetGlobalScreenPercentage() const =0;
@@ -118,6 +400,10 @@ public:
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Set Default View Position"), Category = "VP Stage API|nDisplay")
 	virtual void SetDefaultViewPosition(FVector NewPosition) = 0;
 
+	////** Set the default view position locally without a transaction or undo record. For tracking the viewer every frame, not synced to Multi-User */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Set Default View Position (Preview)"), Category = "VP Stage API|nDisplay")
+	virtual void SetDefaultViewPositionPreview(FVector NewPosition) = 0;
+
 	
 #pragma endregion 	
 
@@ -469,6 +755,24 @@ public:
 	UFUNCTION(BlueprintCallable, meta=(DisplayName="Set Frustum Highlights Gain"), Category="VP Stage API|Image & Color")
 	virtual void SetFrustumPP_HighlightsGain(FVector4 NewHighlightsGain) = 0;
 
+	//WHOLE GRADE FUNCTIONS
+
+	//Get the full Cluster grade (Global, Shadows, Midtones & Highlights including override flags)
+	UFUNCTION(BlueprintCallable, meta=(DisplayName="Get Cluster Color Grading"), Category="VP Stage API|Image & Color")
+	virtual FStageAPIColorGrading GetClusterColorGrading() const = 0;
+
+	//Set the full Cluster grade in a single transaction
+	UFUNCTION(BlueprintCallable, meta=(DisplayName="Set Cluster Color Grading"), Category="VP Stage API|Image & Color")
+	virtual void SetClusterColorGrading(const FStageAPIColorGrading& NewColorGrading) = 0;
+
+	//Get the full Frustum grade (Global, Shadows, Midtones & Highlights including override flags)
+	UFUNCTION(BlueprintCallable, meta=(DisplayName="Get Frustum Color Grading"), Category="VP Stage API|Image & Color")
+	virtual FStageAPIColorGrading GetFrustumColorGrading() const = 0;
+
+	//Set the full Frustum grade in a single transaction
+	UFUNCTION(BlueprintCallable, meta=(DisplayName="Set Frustum Color Grading"), Category="VP Stage API|Image & Color")
+	virtual void SetFrustumColorGrading(const FStageAPIColorGrading& NewColorGrading) = 0;
+
 
 #pragma  endregion
 
@@ -482,6 +786,32 @@ public:
 	UFUNCTION(BlueprintCallable, meta=(DisplayName="Set Sequencer Position Seconds"), Category="VP Stage API|Sequencer")
 	virtual void SetSequencerTime (float PlayHeadInSeconds) =0;
 
+	////** Playhead position in the display rate (UI frames) or the tick resolution */
+	UFUNCTION(BlueprintCallable, meta=(DisplayName="Get Sequencer Frame Time"), Category="VP Stage API|Sequencer")
+	virtual FFrameTime GetSequencerFrameTime(EStageAPISequencerTimeBase TimeBase) const = 0;
+
+	////** Moves the playhead to a frame time in the display rate or the tick resolution */
+	UFUNCTION(BlueprintCallable, meta=(DisplayName="Set Sequencer Frame Time"), Category="VP Stage API|Sequencer")
+	virtual void SetSequencerFrameTime(FFrameTime Time, EStageAPISequencerTimeBase TimeBase) = 0;
+
+	UFUNCTION(BlueprintCallable, meta=(DisplayName="Get Sequencer Frame"), Category="VP Stage API|Sequencer")
+	virtual int32 GetSequencerFrame(EStageAPISequencerTimeBase TimeBase) const = 0;
+
+	UFUNCTION(BlueprintCallable, meta=(DisplayName="Set Sequencer Frame"), Category="VP Stage API|Sequencer")
+	virtual void SetSequencerFrame(int32 Frame, EStageAPISequencerTimeBase TimeBase) = 0;
+
+	////** Playhead position as timecode in the sequence's display rate, drop frame where the rate supports it */
+	UFUNCTION(BlueprintCallable, meta=(DisplayName="Get Sequencer Timecode"), Category="VP Stage API|Sequencer")
+	virtual FTimecode GetSequencerTimecode() const = 0;
+
+	////** Moves the playhead to a sequence timecode in the display rate */
+	UFUNCTION(BlueprintCallable, meta=(DisplayName="Set Sequencer Timecode"), Category="VP Stage API|Sequencer")
+	virtual void SetSequencerTimecode(FTimecode Timecode) = 0;
+
+	////** Starts playback from the given time with a single Sequencer evaluation */
+	UFUNCTION(BlueprintCallable, meta=(DisplayName="Seek And Play Sequencer"), Category="VP Stage API|Sequencer")
+	virtual void SeekAndPlaySequencer(FFrameTime Time, EStageAPISequencerTimeBase TimeBase) = 0;
+
 	UFUNCTION(BlueprintCallable, meta=(DisplayName="Reset Sequencer"), Category="VP Stage API|Sequencer")
 	virtual void ResetSequencer() =0;
 
@@ -512,6 +842,26 @@ public:
 	UFUNCTION(BlueprintCallable, meta=(DisplayName="Is Sequencer Playing"), Category="VP Stage API|Sequencer")
 	virtual bool IsSequencerPlaying () const = 0;
 
+	////** Time, frame, rates, speed, loop mode, playback status and loaded sequence in a single call */
+	UFUNCTION(BlueprintCallable, meta=(DisplayName="Get Sequencer Status"), Category="VP Stage API|Sequencer")
+	virtual FStageAPISequencerStatus GetSequencerStatus() const = 0;
+
+	////** As Get Sequencer Status, but read once per frame and shared by every caller in that frame */
+	UFUNCTION(BlueprintCallable, meta=(DisplayName="Get Sequencer Status (Cached)"), Category="VP Stage API|Sequencer")
+	virtual FStageAPISequencerStatus GetSequencerStatusCached() const = 0;
+
+	////** Level Sequences currently open in Sequencer, oldest first */
+	UFUNCTION(BlueprintCallable, meta=(DisplayName="Get Open Level Sequences"), Category="VP Stage API|Sequencer")
+	virtual TArray<ULevelSequence*> GetOpenLevelSequences() const = 0;
+
+	////** The Level Sequence the Sequencer controls act on. Defaults to the most recently opened one */
+	UFUNCTION(BlueprintCallable, meta=(DisplayName="Get Active Level Sequence"), Category="VP Stage API|Sequencer")
+	virtual ULevelSequence* GetActiveLevelSequence() const = 0;
+
+	////** Targets the Sequencer controls at an open Level Sequence. Returns false if it is not open in Sequencer */
+	UFUNCTION(BlueprintCallable, meta=(DisplayName="Set Active Level Sequence"), Category="VP Stage API|Sequencer")
+	virtual bool SetActiveLevelSequence(ULevelSequence* Sequence) = 0;
+
 #pragma  endregion
 
 	//Send a Take Recorder Start Message via MultiUser
@@ -523,3 +873,65 @@ public:
 	virtual void  SendMUMessage_TakeRecordStop() =0;
 	
 };
+
+/**
+ * Scoped C++ helper for IStageAPIEditor batches. Commits the batch when it goes out of scope.
+ *
+ *	{
+ *		FStageAPIScopedBatch Batch(API, TEXT("Recall Look"));
+ *		API.SetFrustumExposure(1.5f);
+ *		API.SetFrustumFOVMult(1.2f);
+ *	}
+ */
+class FStageAPIScopedBatch
+{
+public:
+	FStageAPIScopedBatch(IStageAPIEditor& InAPI, const FString& Description)
+		: API(InAPI)
+	{
+		API.BeginBatch(Description);
+	}
+
+	~FStageAPIScopedBatch()
+	{
+		API.CommitBatch();
+	}
+
+	FStageAPIScopedBatch(const FStageAPIScopedBatch&) = delete;
+	FStageAPIScopedBatch& operator=(const FStageAPIScopedBatch&) = delete;
+
+private:
+	IStageAPIEditor& API;
+};
+
+/** Targets API calls at a specific nDisplay root for the lifetime of the guard */
+class FStageAPIScopedTargetRoot
+{
+public:
+	FStageAPIScopedTargetRoot(IStageAPIEditor& InAPI, FName RootName)
+		: API(InAPI)
+		, bPushed(InAPI.PushTargetRoot(RootName))
+	{
+	}
+
+	~FStageAPIScopedTargetRoot()
+	{
+		if (bPushed)
+		{
+			API.PopTargetRoot();
+		}
+	}
+
+	/** False if the root was not found, calls then go to the active root */
+	bool IsValid() const
+	{
+		return bPushed;
+	}
+
+	FStageAPIScopedTargetRoot(const FStageAPIScopedTargetRoot&) = delete;
+	FStageAPIScopedTargetRoot& operator=(const FStageAPIScopedTargetRoot&) = delete;
+
+private:
+	IStageAPIEditor& API;
+	bool bPushed;
+};
@@ -0,0 +1,417 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/EnumRange.h"
+
+#include "StageAPITypes.generated.h"
+
+class ULevelSequence;
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+// Color Grading
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+////** One band (Global, Shadows, Midtones or Highlights) of a cluster or frustum color grade */
+USTRUCT(BlueprintType)
+struct VPSTAGEAPIEDITOR_API FStageAPIColorGradingBand
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VP Stage API|Image & Color")
+	bool bOverride_Saturation = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VP Stage API|Image & Color")
+	FVector4 Saturation = FVector4(1.0f, 1.0f, 1.0f, 1.0f);
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VP Stage API|Image & Color")
+	bool bOverride_Contrast = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VP Stage API|Image & Color")
+	FVector4 Contrast = FVector4(1.0f, 1.0f, 1.0f, 1.0f);
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VP Stage API|Image & Color")
+	bool bOverride_Gamma = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VP Stage API|Image & Color")
+	FVector4 Gamma = FVector4(1.0f, 1.0f, 1.0f, 1.0f);
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VP Stage API|Image & Color")
+	bool bOverride_Gain = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VP Stage API|Image & Color")
+	FVector4 Gain = FVector4(1.0f, 1.0f, 1.0f, 1.0f);
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VP Stage API|Image & Color")
+	bool bOverride_Offset = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VP Stage API|Image & Color")
+	FVector4 Offset = FVector4(0.0f, 0.0f, 0.0f, 0.0f);
+
+	bool operator==(const FStageAPIColorGradingBand& Other) const
+	{
+		return bOverride_Saturation == Other.bOverride_Saturation && Saturation == Other.Saturation
+			&& bOverride_Contrast == Other.bOverride_Contrast && Contrast == Other.Contrast
+			&& bOverride_Gamma == Other.bOverride_Gamma && Gamma == Other.Gamma
+			&& bOverride_Gain == Other.bOverride_Gain && Gain == Other.Gain
+			&& bOverride_Offset == Other.bOverride_Offset && Offset == Other.Offset;
+	}
+
+	bool operator!=(const FStageAPIColorGradingBand& Other) const
+	{
+		return !(*this == Other);
+	}
+
+	bool Equals(const FStageAPIColorGradingBand& Other, float Tolerance) const
+	{
+		return bOverride_Saturation == Other.bOverride_Saturation && Saturation.Equals(Other.Saturation, Tolerance)
+			&& bOverride_Contrast == Other.bOverride_Contrast && Contrast.Equals(Other.Contrast, Tolerance)
+			&& bOverride_Gamma == Other.bOverride_Gamma && Gamma.Equals(Other.Gamma, Tolerance)
+			&& bOverride_Gain == Other.bOverride_Gain && Gain.Equals(Other.Gain, Tolerance)
+			&& bOverride_Offset == Other.bOverride_Offset && Offset.Equals(Other.Offset, Tolerance);
+	}
+};
+
+////** The full Global/Shadows/Midtones/Highlights color grade of the cluster or a frustum, including override flags */
+USTRUCT(BlueprintType)
+struct VPSTAGEAPIEDITOR_API FStageAPIColorGrading
+{
+	GENERATED_BODY()
+
+	//Enables the grade on the cluster (EntireClusterColorGrading) or frustum (AllNodesColorGrading)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VP Stage API|Image & Color")
+	bool bEnableColorGrading = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VP Stage API|Image & Color")
+	FStageAPIColorGradingBand Global;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VP Stage API|Image & Color")
+	FStageAPIColorGradingBand Shadows;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VP Stage API|Image & Color")
+	FStageAPIColorGradingBand Midtones;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VP Stage API|Image & Color")
+	FStageAPIColorGradingBand Highlights;
+
+	bool operator==(const FStageAPIColorGrading& Other) const
+	{
+		return bEnableColorGrading == Other.bEnableColorGrading
+			&& Global == Other.Global && Shadows == Other.Shadows
+			&& Midtones == Other.Midtones && Highlights == Other.Highlights;
+	}
+
+	bool operator!=(const FStageAPIColorGrading& Other) const
+	{
+		return !(*this == Other);
+	}
+
+	bool Equals(const FStageAPIColorGrading& Other, float Tolerance) const
+	{
+		return bEnableColorGrading == Other.bEnableColorGrading
+			&& Global.Equals(Other.Global, Tolerance) && Shadows.Equals(Other.Shadows, Tolerance)
+			&& Midtones.Equals(Other.Midtones, Tolerance) && Highlights.Equals(Other.Highlights, Tolerance);
+	}
+};
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+// Viewport Render Settings
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+////** Render cost settings of a single nDisplay viewport */
+USTRUCT(BlueprintType)
+struct VPSTAGEAPIEDITOR_API FStageAPIViewportRenderSettings
+{
+	GENERATED_BODY()
+
+	//Viewport screen percentage (RenderSettings.BufferRatio)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VP Stage API|Render Tiers", meta = (ClampMin = "0.01", UIMin = "0.01", UIMax = "1"))
+	float BufferRatio = 1.0f;
+
+	//Size of the viewport render target relative to its region (RenderSettings.RenderTargetRatio)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VP Stage API|Render Tiers", meta = (ClampMin = "0.01", UIMin = "0.01", UIMax = "1"))
+	float RenderTargetRatio = 1.0f;
+
+	bool operator==(const FStageAPIViewportRenderSettings& Other) const
+	{
+		return BufferRatio == Other.BufferRatio && RenderTargetRatio == Other.RenderTargetRatio;
+	}
+
+	bool operator!=(const FStageAPIViewportRenderSettings& Other) const
+	{
+		return !(*this == Other);
+	}
+};
+
+////** Render settings for every viewport whose name matches the pattern. Patterns support * and ? wildcards */
+USTRUCT(BlueprintType)
+struct VPSTAGEAPIEDITOR_API FStageAPIRenderTierEntry
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VP Stage API|Render Tiers")
+	FString ViewportPattern = TEXT("*");
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VP Stage API|Render Tiers")
+	FStageAPIViewportRenderSettings Settings;
+};
+
+////** A named render cost profile. The first matching entry wins, viewports without a match are left untouched */
+USTRUCT(BlueprintType)
+struct VPSTAGEAPIEDITOR_API FStageAPIRenderTier
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VP Stage API|Render Tiers")
+	TArray<FStageAPIRenderTierEntry> Entries;
+};
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+// Stage State
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+////** Lens and placement of one ICVFX frustum camera */
+USTRUCT(BlueprintType)
+struct VPSTAGEAPIEDITOR_API FStageAPIFrustumState
+{
+	GENERATED_BODY()
+
+	//False if the camera does not exist, all other fields are then defaults
+	UPROPERTY(BlueprintReadOnly, Category = "VP Stage API|Stage State")
+	bool bValid = false;
+
+	UPROPERTY(BlueprintReadOnly, Category = "VP Stage API|Stage State")
+	float FOVMult = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "VP Stage API|Stage State")
+	float Exposure = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "VP Stage API|Stage State")
+	float Aperture = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "VP Stage API|Stage State")
+	float FocalDistance = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "VP Stage API|Stage State")
+	FVector Position = FVector::ZeroVector;
+
+	UPROPERTY(BlueprintReadOnly, Category = "VP Stage API|Stage State")
+	FRotator Rotation = FRotator::ZeroRotator;
+};
+
+////** Everything the stage getters expose, read in one pass */
+USTRUCT(BlueprintType)
+struct VPSTAGEAPIEDITOR_API FStageAPIStageState
+{
+	GENERATED_BODY()
+
+	//False if no nDisplay root was found, all other fields are then defaults
+	UPROPERTY(BlueprintReadOnly, Category = "VP Stage API|Stage State")
+	bool bValid = false;
+
+	UPROPERTY(BlueprintReadOnly, Category = "VP Stage API|Stage State")
+	FVector StagePosition = FVector::ZeroVector;
+
+	UPROPERTY(BlueprintReadOnly, Category = "VP Stage API|Stage State")
+	FRotator StageRotation = FRotator::ZeroRotator;
+
+	UPROPERTY(BlueprintReadOnly, Category = "VP Stage API|Stage State")
+	FVector DefaultViewPosition = FVector::ZeroVector;
+
+	UPROPERTY(BlueprintReadOnly, Category = "VP Stage API|Stage State")
+	float StageExposure = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "VP Stage API|Stage State")
+	float GlobalScreenPercentage = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "VP Stage API|Stage State")
+	bool bInnerFrustumEnabled = false;
+
+	UPROPERTY(BlueprintReadOnly, Category = "VP Stage API|Stage State")
+	bool bChromakeyEnabled = false;
+
+	UPROPERTY(BlueprintReadOnly, Category = "VP Stage API|Stage State")
+	bool bCameraBActive = false;
+
+	UPROPERTY(BlueprintReadOnly, Category = "VP Stage API|Stage State")
+	float FrustumRenderRatio = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "VP Stage API|Stage State")
+	FStageAPIFrustumState FrustumA;
+
+	UPROPERTY(BlueprintReadOnly, Category = "VP Stage API|Stage State")
+	FStageAPIFrustumState FrustumB;
+
+	UPROPERTY(BlueprintReadOnly, Category = "VP Stage API|Stage State")
+	FStageAPIColorGrading ClusterColorGrading;
+
+	UPROPERTY(BlueprintReadOnly, Category = "VP Stage API|Stage State")
+	FStageAPIColorGrading FrustumColorGrading;
+};
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+// Properties
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Identifies a single stage parameter that the API can read and write generically. Values are passed as FVector4:
+ * scalars use X, bools use X != 0, FVectors use XYZ and FRotators use (Pitch, Yaw, Roll).
+ *
+ * New entries must be added before Count, existing values are part of saved data and must not be reordered.
+ */
+UENUM(BlueprintType)
+enum class EStageAPIProperty : uint8
+{
+	None,
+
+	//Stage
+	StagePosition,
+	StageRotation,
+	DefaultViewPosition,
+	StageExposure,
+	GlobalScreenPercentage,
+	InnerFrustumEnabled,
+	ChromakeyEnabled,
+
+	//Frustum Main
+	FrustumFOVMult,
+	FrustumExposure,
+	FrustumAperture,
+	FrustumFocalDistance,
+	FrustumPosition,
+	FrustumRotation,
+	FrustumRenderRatio,
+
+	//Frustum Secondary
+	FrustumFOVMultB,
+	FrustumExposureB,
+	FrustumApertureB,
+	FrustumFocalDistanceB,
+	FrustumPositionB,
+	FrustumRotationB,
+
+	//Cluster Grade
+	ClusterGlobalSaturation,
+	ClusterGlobalContrast,
+	ClusterGlobalGamma,
+	ClusterGlobalGain,
+	ClusterGlobalOffset,
+	ClusterShadowsGain,
+	ClusterMidsGain,
+	ClusterHighlightsGain,
+
+	//Frustum Grade
+	FrustumGlobalSaturation,
+	FrustumGlobalContrast,
+	FrustumGlobalGamma,
+	FrustumGlobalGain,
+	FrustumGlobalOffset,
+	FrustumShadowsGain,
+	FrustumMidsGain,
+	FrustumHighlightsGain,
+
+	Count UMETA(Hidden)
+};
+ENUM_RANGE_BY_COUNT(EStageAPIProperty, EStageAPIProperty::Count);
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+// Sequencer
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+////** Which rate a frame number passed to the Sequencer seek calls is expressed in */
+UENUM(BlueprintType)
+enum class EStageAPISequencerTimeBase : uint8
+{
+	//The sequence's display rate, the frame numbers shown in the Sequencer UI
+	DisplayRate,
+	//The sequence's tick resolution, the rate keys and sections are stored at
+	TickResolution,
+};
+
+////** Sequencer playback state, mirrors EMovieScenePlayerStatus */
+UENUM(BlueprintType)
+enum class EStageAPIPlaybackStatus : uint8
+{
+	Stopped,
+	Playing,
+	Scrubbing,
+	Jumping,
+	Stepping,
+	Paused,
+};
+
+////** Everything the transport UI needs from Sequencer, read in one pass */
+USTRUCT(BlueprintType)
+struct VPSTAGEAPIEDITOR_API FStageAPISequencerStatus
+{
+	GENERATED_BODY()
+
+	//False if no Level Sequence is open in Sequencer, all other fields are then defaults
+	UPROPERTY(BlueprintReadOnly, Category = "VP Stage API|Sequencer")
+	bool bValid = false;
+
+	UPROPERTY(BlueprintReadOnly, Category = "VP Stage API|Sequencer")
+	float TimeSeconds = 0.0f;
+
+	//Playhead in the display rate
+	UPROPERTY(BlueprintReadOnly, Category = "VP Stage API|Sequencer")
+	FFrameTime DisplayFrameTime;
+
+	UPROPERTY(BlueprintReadOnly, Category = "VP Stage API|Sequencer")
+	int32 DisplayFrame = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "VP Stage API|Sequencer")
+	FFrameRate DisplayRate;
+
+	UPROPERTY(BlueprintReadOnly, Category = "VP Stage API|Sequencer")
+	FFrameRate TickResolution;
+
+	UPROPERTY(BlueprintReadOnly, Category = "VP Stage API|Sequencer")
+	float PlaybackSpeed = 1.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "VP Stage API|Sequencer")
+	bool bLooping = false;
+
+	//Range playback wraps within while looping, in the display rate: the selection range when looping it, otherwise
+	//the playback range. The end is exclusive
+	UPROPERTY(BlueprintReadOnly, Category = "VP Stage API|Sequencer")
+	FFrameTime LoopStartFrameTime;
+
+	UPROPERTY(BlueprintReadOnly, Category = "VP Stage API|Sequencer")
+	FFrameTime LoopEndFrameTime;
+
+	UPROPERTY(BlueprintReadOnly, Category = "VP Stage API|Sequencer")
+	EStageAPIPlaybackStatus PlaybackStatus = EStageAPIPlaybackStatus::Stopped;
+
+	UPROPERTY(BlueprintReadOnly, Category = "VP Stage API|Sequencer")
+	ULevelSequence* Sequence = nullptr;
+};
+
+////** Call duration percentiles of one API function since the last reset */
+USTRUCT(BlueprintType)
+struct VPSTAGEAPIEDITOR_API FStageAPILatencyStats
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "VP Stage API|Latency")
+	FName FunctionName;
+
+	UPROPERTY(BlueprintReadOnly, Category = "VP Stage API|Latency")
+	int64 Calls = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "VP Stage API|Latency")
+	float P50Us = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "VP Stage API|Latency")
+	float P95Us = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "VP Stage API|Latency")
+	float P99Us = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "VP Stage API|Latency")
+	float MaxUs = 0.0f;
+};
@@ -15,5 +15,16 @@ public:
 
 	UFUNCTION(BlueprintPure, meta = (DisplayName = "Get VP Stage API"), Category = "VP Stage API")
 	static void GetAPI(TScriptInterface<IStageAPIEditor>& OutAPI);
+
+	////** Latency percentiles of one API function, e.g. "SetFrustumExposure". Returns false if it has not been called */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Get API Latency"), Category = "VP Stage API|Latency")
+	static bool GetAPILatency(FName FunctionName, FStageAPILatencyStats& OutStats);
+
+	////** Latency percentiles of every API function called since the last reset, slowest p99 first */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Get All API Latencies"), Category = "VP Stage API|Latency")
+	static TArray<FStageAPILatencyStats> GetAllAPILatencies();
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Reset API Latencies"), Category = "VP Stage API|Latency")
+	static void ResetAPILatencies();
 	
 };
@@ -0,0 +1,140 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EditorSubsystem.h"
+#include "Containers/Ticker.h"
+#include "Misc/FrameRate.h"
+#include "Misc/Timecode.h"
+#include "API/StageAPITypes.h"
+#include "StageAPICueListSubsystem.generated.h"
+
+////** Clock the cue list follows */
+UENUM(BlueprintType)
+enum class EStageAPICueTimeSource : uint8
+{
+	//Global time of the Level Sequence open in Sequencer, cues only fire while it is playing
+	Sequencer,
+	//Engine timecode (timecode provider), cue times are seconds since midnight
+	Timecode,
+};
+
+////** A single API parameter change made by a cue */
+USTRUCT(BlueprintType)
+struct VPSTAGEAPIEDITOR_API FStageAPICueChange
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VP Stage API|Cues")
+	EStageAPIProperty Property = EStageAPIProperty::None;
+
+	//Value in the EStageAPIProperty layout
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VP Stage API|Cues")
+	FVector4 Value = FVector4(0, 0, 0, 0);
+};
+
+////** A set of parameter changes fired at a point in time */
+USTRUCT(BlueprintType)
+struct VPSTAGEAPIEDITOR_API FStageAPICue
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VP Stage API|Cues")
+	FName Name;
+
+	//Sequencer time or timecode in seconds, depending on the time source
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VP Stage API|Cues")
+	double TimeSeconds = 0.0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VP Stage API|Cues")
+	TArray<FStageAPICueChange> Changes;
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnStageCueFired, FName, CueName, double, TimeSeconds);
+
+/**
+ * Fires cues at fixed points of a shot. The cue list is kept sorted by time, every tick the clock is read and the
+ * cues passed since the previous tick are found by binary search and applied in one transaction. Cues fire on the
+ * first frame whose time reaches them, jumps backwards (scrubbing, looping) only reposition the list.
+ */
+UCLASS()
+class VPSTAGEAPIEDITOR_API UStageAPICueListSubsystem : public UEditorSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	//Fires once per cue after the cues of the frame have been applied
+	UPROPERTY(BlueprintAssignable, Category = "VP Stage API|Cues")
+	FOnStageCueFired OnCueFired;
+
+	////** Adds a cue, keeping the list sorted. Cues at the same time fire in the order they were added */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Add Cue"), Category = "VP Stage API|Cues")
+	void AddCue(const FStageAPICue& Cue);
+
+	////** Adds a cue at a timecode in the given frame rate. Only meaningful with the Timecode time source */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Add Cue At Timecode"), Category = "VP Stage API|Cues")
+	void AddCueAtTimecode(FName Name, FTimecode Timecode, FFrameRate FrameRate, const TArray<FStageAPICueChange>& Changes);
+
+	////** Removes every cue with this name. Returns the number of cues removed */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Remove Cue"), Category = "VP Stage API|Cues")
+	int32 RemoveCue(FName Name);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Clear Cues"), Category = "VP Stage API|Cues")
+	void ClearCues();
+
+	////** The cue list sorted by time */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Get Cues"), Category = "VP Stage API|Cues")
+	TArray<FStageAPICue> GetCues() const { return Cues; }
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Set Cue Time Source"), Category = "VP Stage API|Cues")
+	void SetTimeSource(EStageAPICueTimeSource InTimeSource);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Get Cue Time Source"), Category = "VP Stage API|Cues")
+	EStageAPICueTimeSource GetTimeSource() const { return TimeSource; }
+
+	////** Starts or stops firing. Cues already passed when armed do not fire */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Set Cue List Armed"), Category = "VP Stage API|Cues")
+	void SetArmed(bool bInArmed);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Is Cue List Armed"), Category = "VP Stage API|Cues")
+	bool IsArmed() const { return bArmed; }
+
+	////** The next cue after the current time. Returns false if there is none or the clock is unavailable */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Get Next Cue"), Category = "VP Stage API|Cues")
+	bool GetNextCue(FStageAPICue& OutCue) const;
+
+	////** Applies a cue now regardless of time. Returns false if no cue has this name */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Fire Cue"), Category = "VP Stage API|Cues")
+	bool FireCue(FName Name);
+
+private:
+
+	bool Tick(float DeltaTime);
+
+	//Reads the clock in seconds. bOutAdvancing is false while the clock is not running forward (Sequencer paused or scrubbing).
+	//OutLoopRange is the range Sequencer playback wraps within, empty when not looping or on the timecode clock
+	bool GetCurrentTime(double& OutTimeSeconds, bool& bOutAdvancing, TRange<double>& OutLoopRange) const;
+
+	//Applies Cues[FirstIndex, LastIndex) in one transaction
+	void FireCues(int32 FirstIndex, int32 LastIndex);
+
+	//Sorted by TimeSeconds
+	TArray<FStageAPICue> Cues;
+
+	EStageAPICueTimeSource TimeSource = EStageAPICueTimeSource::Sequencer;
+	bool bArmed = false;
+
+	//Clock value of the previous tick, cues in (LastTimeSeconds, Now] fire. When the clock starts advancing from a
+	//parked position [LastTimeSeconds, Now] fires instead, so a cue at the start position is not skipped. When looping
+	//playback wrapped since the last tick, the rest of the pass to the loop end and [loop start, Now] fire
+	double LastTimeSeconds = 0.0;
+	bool bHasLastTime = false;
+	bool bLastAdvancing = false;
+
+	FTSTicker::FDelegateHandle TickerHandle;
+};
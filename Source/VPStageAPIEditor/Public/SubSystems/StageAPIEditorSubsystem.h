@@ -4,14 +4,68 @@
 
 #include "CoreMinimal.h"
 #include "EditorSubsystem.h"
+#include "Containers/Ticker.h"
+#include "API/StageAPITypes.h"
 #include "StageAPIEditorSubsystem.generated.h"
 
+struct FTransactionObjectEvent;
+class ADisplayClusterRootActor;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnStagePropertyChanged, EStageAPIProperty, Property, FVector4, Value);
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnStagePropertyChangedNative, EStageAPIProperty /*Property*/, const FVector4& /*Value*/);
+
 /**
- * 
+ * Pushes stage property changes to UIs instead of them polling the API. Changes from local API calls and from
+ * transactions (undo/redo, other Multi-User clients) are collected during the frame, then the stage properties
+ * are compared against the last broadcast values and one notification per changed property is sent.
  */
 UCLASS()
 class VPSTAGEAPIEDITOR_API UStageAPIEditorSubsystem : public UEditorSubsystem
 {
 	GENERATED_BODY()
-	
+
+public:
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	//Fires once per frame for every stage property whose value changed. Values use the EStageAPIProperty layout
+	UPROPERTY(BlueprintAssignable, Category = "VP Stage API|Notifications")
+	FOnStagePropertyChanged OnStagePropertyChanged;
+
+	//Native version of OnStagePropertyChanged
+	FOnStagePropertyChangedNative OnStagePropertyChangedNative;
+
+	//Flags the stage as changed, the properties are compared on the next tick. Called by the API setters
+	void MarkStagePropertiesDirty();
+
+	//Called by the API whenever it rescans for its root. A new root takes a fresh baseline right away, so the
+	//change made by the API call that found the stage is already compared against it
+	void SetStageRoot(ADisplayClusterRootActor* Root);
+
+	//Compares and broadcasts immediately instead of waiting for the next tick
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Flush Stage Notifications"), Category = "VP Stage API|Notifications")
+	void FlushStagePropertyNotifications();
+
+private:
+
+	bool Tick(float DeltaTime);
+
+	void HandleObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& PropertyChangedEvent);
+	void HandleObjectTransacted(UObject* Object, const FTransactionObjectEvent& TransactionEvent);
+
+	//True for the nDisplay root, its subobjects and components, the stage parent and the frustum cameras
+	bool IsStageObject(const UObject* Object) const;
+
+	//Last broadcast value per property
+	FVector4 LastValues[static_cast<uint8>(EStageAPIProperty::Count)];
+	bool bHasLastValues = false;
+	bool bDirty = false;
+
+	//Root the baseline was read from. Kept here so IsStageObject does not go through the API for every property change
+	TWeakObjectPtr<ADisplayClusterRootActor> StageRoot;
+
+	FTSTicker::FDelegateHandle TickerHandle;
+	FDelegateHandle OnObjectPropertyChangedHandle;
+	FDelegateHandle OnObjectTransactedHandle;
 };
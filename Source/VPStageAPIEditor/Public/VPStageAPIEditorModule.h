@@ -7,11 +7,43 @@
 
 DECLARE_LOG_CATEGORY_EXTERN(StageAPIEditor, Log, All);
 
+class FStageAPIRemoteServer;
+class FStageAPIOscListener;
+class FStageAPIDmxInput;
+
 class FVPStageAPIEditorModule : public IModuleInterface
 {
 public:
 
+	FVPStageAPIEditorModule();
+	virtual ~FVPStageAPIEditorModule() override;
+
 	/** IModuleInterface implementation */
 	virtual void StartupModule() override;
 	virtual void ShutdownModule() override;
+
+	/** Starts the remote control server on the given interface, restarting it if it already runs */
+	bool StartRemoteServer(const FString& BindAddress, uint16 Port);
+	void StopRemoteServer();
+	bool IsRemoteServerRunning() const;
+
+	/** Starts the OSC listener on the given interface, restarting it if it already runs. Address mappings are kept */
+	bool StartOscListener(const FString& BindAddress, uint16 Port);
+	void StopOscListener();
+	bool IsOscListenerRunning() const;
+	/** Maps an OSC address to a Stage API property, e.g. /stage/frustum/exposure -> FrustumExposure */
+	bool SetOscAddressMapping(const FString& Address, const FString& PropertyName);
+
+	/** Starts DMX input, Protocol is ArtNet or sACN. Restarts it if it already runs, mappings are kept */
+	bool StartDmxInput(const FString& Protocol, const FString& BindAddress);
+	void StopDmxInput();
+	bool IsDmxInputRunning() const;
+	/** The DMX input and its channel mappings, created on first use */
+	FStageAPIDmxInput& GetDmxInput();
+
+private:
+
+	TUniquePtr<FStageAPIRemoteServer> RemoteServer;
+	TUniquePtr<FStageAPIOscListener> OscListener;
+	TUniquePtr<FStageAPIDmxInput> DmxInput;
 };
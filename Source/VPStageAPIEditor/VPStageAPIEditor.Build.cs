@@ -41,10 +41,11 @@ public class VPStageAPIEditor : ModuleRules
 				"SlateCore",
 				"EditorSubsystem", 
 				"DisplayClusterConfiguration", "DisplayCluster", 
-				"LevelSequence", "Sequencer"
+				"LevelSequence", "MovieScene", "Sequencer"
 				, "LevelSequenceEditor"
 				,"UnrealEd","EditorFramework"
 				,"MultiUserClient", "ConcertSyncClient","ConcertSyncCore", "Concert", "ConcertTransport", "ConcertTakeRecorder", "TakeRecorder", "TakesCore",
+				"Json", "Projects", "Sockets", "Networking",
 				/*
 				"Projects",
 				"EditorFramework",